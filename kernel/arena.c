@@ -0,0 +1,48 @@
+#include "arena.h"
+#include "pmm.h"
+
+void arena_init_range(Arena *arena, void *base, size_t bytes) {
+    arena->base = (uintptr_t)base;
+    arena->top = arena->base;
+    arena->end = arena->base + bytes;
+    arena->allocs = 0;
+}
+
+int arena_init_frames(Arena *arena, size_t bytes) {
+    uint32_t frames = (uint32_t)((bytes + PMM_FRAME - 1) / PMM_FRAME);
+    uintptr_t base = pmm_alloc_frames(frames);
+    if (!base) return -1;
+    arena_init_range(arena, (void *)base, (size_t)frames * PMM_FRAME);
+    return 0;
+}
+
+void *arena_alloc(Arena *arena, size_t bytes, size_t align) {
+    if (align == 0) align = 1;
+    uintptr_t p = (arena->top + align - 1) & ~(uintptr_t)(align - 1);
+    if (p < arena->top || p > arena->end || bytes > arena->end - p) return NULL;
+
+    volatile unsigned char *z = (volatile unsigned char *)p;   // Not turned into a memset call
+    for (size_t i = 0; i < bytes; i++) z[i] = 0;
+    arena->top = p + bytes;
+    arena->allocs++;
+    return (void *)p;
+}
+
+void arena_release(Arena *arena, void *p, size_t bytes) {
+    if (!p) return;
+    if ((uintptr_t)p + bytes == arena->top) arena->top = (uintptr_t)p;
+    if (arena->allocs) arena->allocs--;
+}
+
+void arena_reset(Arena *arena) {
+    arena->top = arena->base;
+    arena->allocs = 0;
+}
+
+size_t arena_used(const Arena *arena) {
+    return arena->top - arena->base;
+}
+
+size_t arena_free(const Arena *arena) {
+    return arena->end - arena->top;
+}
@@ -0,0 +1,45 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Bump arena for boot-time allocations (kernel): grid buffers, rings,
+ * per-core stacks. Allocations are aligned and zeroed; only the newest
+ * block can be handed back, and arena_reset() drops everything at once.
+ */
+
+typedef struct {
+    uintptr_t base;
+    uintptr_t top;          // Next free byte
+    uintptr_t end;
+    uint32_t allocs;        // Live allocations
+} Arena;
+
+void arena_init_range(Arena *arena, void *base, size_t bytes);
+
+/**
+ * @brief Back the arena with contiguous frames from the PMM.
+ * @return 0 on success, -1 if no run of frames is that long.
+ */
+int arena_init_frames(Arena *arena, size_t bytes);
+
+/**
+ * @brief Zeroed block of bytes at a multiple of align (a power of two).
+ * @return The block, or NULL if the arena is full.
+ */
+void *arena_alloc(Arena *arena, size_t bytes, size_t align);
+
+/**
+ * @brief Give back the newest block (alignment padding stays used).
+ *        Any other block is kept until arena_reset().
+ */
+void arena_release(Arena *arena, void *p, size_t bytes);
+
+void arena_reset(Arena *arena);
+
+size_t arena_used(const Arena *arena);
+size_t arena_free(const Arena *arena);
+
+#endif // ARENA_H
@@ -22,7 +22,7 @@ void render_banner(const SystemState *state) {
     
     if (state->stability < 40.0f) {
         base_fg = RED;
-        alt_fg = YELOW;
+        alt_fg = YELLOW;
     } else if (state->stability < 70.0f) {
         base_fg = CYAN;
         alt_fg = MAGENTA;
@@ -32,10 +32,33 @@ _start:
     mov al, 3
     out dx, al ; 8 bits, no parity, one stop bit
 
+%ifdef KERNEL_SSE
+    ; SSE build (nasm -DKERNEL_SSE): the physics core is compiled with
+    ; -msse2 -mfpmath=sse, so turn on the FPU and SSE state before any C
+    mov esi, eax                ; cpuid clobbers the Multiboot magic/info
+    mov edi, ebx
+    mov eax, 1
+    cpuid
+    test edx, 1 << 26           ; SSE2
+    jz .hlt                     ; Halt here rather than #UD in the physics core
+    mov eax, cr0
+    and eax, ~(1 << 2)          ; EM off: FPU instructions execute
+    or eax, (1 << 1) | (1 << 5) ; MP, NE (native FPU errors)
+    mov cr0, eax
+    mov eax, cr4
+    or eax, (1 << 9) | (1 << 10) ; OSFXSR, OSXMMEXCPT
+    mov cr4, eax
+    fninit
+    mov eax, esi
+    mov ebx, edi
+%endif
+
     ; Set up a basic stack
     mov esp, stack_top
 
-    ; Call the C kernel (passing Multiboot magic and info)
+    ; Call the C kernel (passing Multiboot magic and info) with the stack
+    ; 16-byte aligned at the call, as the i386 ABI (and SSE spills) expect
+    sub esp, 8
     push ebx
     push eax
     call kernel_main
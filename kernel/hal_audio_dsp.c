@@ -0,0 +1,243 @@
+#include <math.h>
+#include <string.h>
+#include "hal_audio_dsp.h"
+
+#define DRAIN_BATCH 16
+#define SPECTRUM_TWO_PI 6.283185307179586
+#define SPECTRUM_PHI_THIRD 1.1739849967053284   // phi^(1/3)
+#define SPECTRUM_FLOOR 1e-12f                   // Mean bin power treated as silence
+#define AUDIO_GATE_RMS 0.05f
+#define AUDIO_SMOOTH_FRAMES 1024u               // Block the smoothing weights are given for
+
+int hal_audio_spectrum_init(AudioSpectrum *sp, float rate) {
+    if (!(rate > 0.0f)) return -1;
+    for (int i = 0; i < AUDIO_SPECTRUM_N; i++) {
+        double w = 0.5 - 0.5 * cos(SPECTRUM_TWO_PI * i / AUDIO_SPECTRUM_N);
+        sp->window[i] = (float)(w / 32768.0);
+    }
+
+    // Bins past Nyquist keep coef 0 and stay out of the flatness
+    double hz = AUDIO_BANK_BASE_HZ;
+    sp->bins = 0;
+    for (int k = 0; k < AUDIO_BANK_BINS; k++, hz *= SPECTRUM_PHI_THIRD) {
+        sp->hz[k] = (float)hz;
+        sp->coef[k] = 0.0f;
+        if (hz >= 0.45 * rate) continue;
+        sp->coef[k] = (float)(2.0 * cos(SPECTRUM_TWO_PI * hz / rate));
+        sp->bins = k + 1;
+    }
+    hal_audio_spectrum_reset(sp);
+    return (sp->bins > 0) ? 0 : -1;
+}
+
+void hal_audio_spectrum_reset(AudioSpectrum *sp) {
+    for (int k = 0; k < AUDIO_BANK_BINS; k++) {
+        sp->s1[0][k] = sp->s2[0][k] = 0.0f;
+        sp->s1[1][k] = sp->s2[1][k] = 0.0f;
+        sp->power[k] = 0.0f;
+    }
+    sp->pos[0] = 0;
+    sp->pos[1] = -AUDIO_SPECTRUM_HOP;
+    sp->flatness = 1.0f;
+    sp->tonality = 0.0f;
+    sp->peak_hz = 0.0f;
+    sp->frames = 0;
+}
+
+// One Goertzel update per sample for every bin of frame j. The state is
+// held in locals so the bin loop is one aliasing-free vector pass.
+static void spectrum_run(AudioSpectrum *sp, int j, const short *samples, int n) {
+    _Alignas(32) float s1[AUDIO_BANK_BINS], s2[AUDIO_BANK_BINS], coef[AUDIO_BANK_BINS];
+    memcpy(s1, sp->s1[j], sizeof(s1));
+    memcpy(s2, sp->s2[j], sizeof(s2));
+    memcpy(coef, sp->coef, sizeof(coef));
+    const float *w = sp->window + sp->pos[j];
+    for (int i = 0; i < n; i++) {
+        float x = (float)samples[i] * w[i];
+        for (int k = 0; k < AUDIO_BANK_BINS; k++) {
+            float s0 = x + coef[k] * s1[k] - s2[k];
+            s2[k] = s1[k];
+            s1[k] = s0;
+        }
+    }
+    memcpy(sp->s1[j], s1, sizeof(s1));
+    memcpy(sp->s2[j], s2, sizeof(s2));
+    sp->pos[j] += n;
+}
+
+static void spectrum_finish(AudioSpectrum *sp, int j) {
+    float *s1 = sp->s1[j];
+    float *s2 = sp->s2[j];
+    float a = (sp->frames == 0) ? 1.0f : AUDIO_SPECTRUM_SMOOTH;
+    for (int k = 0; k < AUDIO_BANK_BINS; k++) {
+        float p = s1[k] * s1[k] + s2[k] * s2[k] - sp->coef[k] * s1[k] * s2[k];
+        sp->power[k] += a * (p - sp->power[k]);
+        s1[k] = s2[k] = 0.0f;
+    }
+    sp->pos[j] = 0;
+    sp->frames++;
+
+    float sum = 0.0f, best = -1.0f;
+    int peak = 0;
+    for (int k = 0; k < sp->bins; k++) {
+        sum += sp->power[k];
+        if (sp->power[k] > best) {
+            best = sp->power[k];
+            peak = k;
+        }
+    }
+    float mean = sum / (float)sp->bins;
+    if (!(mean > SPECTRUM_FLOOR)) {
+        sp->flatness = 1.0f;
+        sp->tonality = 0.0f;
+        sp->peak_hz = 0.0f;
+        return;
+    }
+    // Powers far below the mean count as a fixed floor, not log(0)
+    float floor_p = mean * 1e-9f, log_sum = 0.0f;
+    for (int k = 0; k < sp->bins; k++) log_sum += logf(sp->power[k] + floor_p);
+    float flat = expf(log_sum / (float)sp->bins) / mean;
+    sp->flatness = (flat > 1.0f) ? 1.0f : flat;
+    sp->tonality = 1.0f - sp->flatness;
+    sp->peak_hz = sp->hz[peak];
+}
+
+uint32_t hal_audio_spectrum_feed(AudioSpectrum *sp, const short *samples, int frames) {
+    uint32_t done = 0;
+    while (frames > 0) {
+        // Cut at the next frame start or end, so frames complete in time order
+        int n = frames;
+        for (int j = 0; j < 2; j++) {
+            int left = (sp->pos[j] < 0) ? -sp->pos[j] : AUDIO_SPECTRUM_N - sp->pos[j];
+            if (left < n) n = left;
+        }
+        for (int j = 0; j < 2; j++) {
+            if (sp->pos[j] < 0) {
+                sp->pos[j] += n;   // Second frame waits out the first hop
+                continue;
+            }
+            spectrum_run(sp, j, samples, n);
+            if (sp->pos[j] == AUDIO_SPECTRUM_N) {
+                spectrum_finish(sp, j);
+                done++;
+            }
+        }
+        samples += n;
+        frames -= n;
+    }
+    return done;
+}
+
+void hal_audio_accum_reset(AudioAccum *acc) {
+    acc->sum_sq = 0;
+    acc->peak = 0;
+    acc->crossings = 0;
+    acc->frames = 0;
+    acc->last = 0;
+}
+
+void hal_audio_accumulate(AudioAccum *acc, const short *samples, int frames) {
+    float sum_sq = acc->sum_sq;
+    float peak = acc->peak;
+    uint32_t crossings = acc->crossings;
+    short last_val = acc->last;
+
+    for (int i = 0; i < frames; i++) {
+        float val = samples[i] / 32768.0f;
+        sum_sq += val * val;
+        float mag = fabsf(val);
+        if (mag > peak) peak = mag;
+
+        if ((samples[i] > 0 && last_val <= 0) || (samples[i] < 0 && last_val >= 0)) {
+            crossings++;
+        }
+        last_val = samples[i];
+    }
+
+    acc->sum_sq = sum_sq;
+    acc->peak = peak;
+    acc->crossings = crossings;
+    acc->frames += (frames > 0) ? (uint32_t)frames : 0u;
+    acc->last = last_val;
+}
+
+int hal_audio_summarize(AudioAccum *acc, AudioSummary *out) {
+    if (acc->frames == 0) return -1;
+    out->rms = sqrtf(acc->sum_sq / (float)acc->frames);
+    out->peak = acc->peak;
+    out->crossings = acc->crossings;
+    out->frames = acc->frames;
+    out->tonality = 0.0f;
+    out->peak_hz = 0.0f;
+    out->captured_ns = 0;
+
+    short last = acc->last;
+    hal_audio_accum_reset(acc);
+    acc->last = last;
+    return 0;
+}
+
+/**
+ * @brief EMA weights for a period of `frames` samples with the same time
+ *        constant as (keep, 1 - keep) per AUDIO_SMOOTH_FRAMES block. A full
+ *        block uses the given pair as is.
+ */
+static void smooth_weights(float keep, float gain, uint32_t frames, float *k, float *g) {
+    if (frames == AUDIO_SMOOTH_FRAMES) {
+        *k = keep;
+        *g = gain;
+        return;
+    }
+    *k = powf(keep, (float)frames / (float)AUDIO_SMOOTH_FRAMES);
+    *g = 1.0f - *k;
+}
+
+void hal_audio_apply(SystemState *state, const AudioSummary *summary) {
+    float rms = summary->rms;
+    float keep, gain;
+    smooth_weights(0.9f, 0.1f, summary->frames, &keep, &gain);
+    state->audio_energy = (keep * state->audio_energy) + (gain * rms);
+
+    // Coherence: a stable whistle or tone concentrates its energy in a few
+    // bank bins (tonality near 1); loud broadband noise does not
+    if (rms > AUDIO_GATE_RMS) {
+        smooth_weights(0.95f, 0.05f, summary->frames, &keep, &gain);
+        state->audio_coherence = (keep * state->audio_coherence) + gain * summary->tonality;
+    } else {
+        smooth_weights(0.99f, 0.01f, summary->frames, &keep, &gain);
+        state->audio_coherence *= keep;
+    }
+}
+
+void hal_audio_analyze(SystemState *state, AudioSpectrum *sp, const short *samples, int frames) {
+    if (frames <= 0) return;
+
+    AudioAccum acc;
+    AudioSummary summary;
+    hal_audio_accum_reset(&acc);
+    hal_audio_accumulate(&acc, samples, frames);
+    hal_audio_spectrum_feed(sp, samples, frames);
+    if (hal_audio_summarize(&acc, &summary) != 0) return;
+    summary.tonality = sp->tonality;
+    summary.peak_hz = sp->peak_hz;
+    hal_audio_apply(state, &summary);
+}
+
+uint32_t hal_audio_drain(SystemState *state, QcoreRing *ring, uint64_t now_ns, AudioLatency *lat) {
+    AudioSummary batch[DRAIN_BATCH];
+    uint32_t total = 0;
+    uint32_t n;
+    while ((n = qcore_ring_pop(ring, batch, DRAIN_BATCH)) > 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            hal_audio_apply(state, &batch[i]);
+            if (!lat) continue;
+            uint64_t ns = (now_ns > batch[i].captured_ns) ? now_ns - batch[i].captured_ns : 0;
+            lat->periods++;
+            lat->last_ns = ns;
+            if (ns > lat->max_ns) lat->max_ns = ns;
+            lat->mean_ns += ((double)ns - lat->mean_ns) / (double)lat->periods;
+        }
+        total += n;
+    }
+    return total;
+}
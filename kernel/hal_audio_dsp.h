@@ -0,0 +1,136 @@
+#ifndef HAL_AUDIO_DSP_H
+#define HAL_AUDIO_DSP_H
+
+#include <stdint.h>
+#include "qcore_metriplectic.h"
+#include "qcore_ring.h"
+
+/**
+ * @brief Features of one capture period, as the capture thread hands them
+ *        to the physics loop.
+ */
+typedef struct {
+    float rms;              // RMS of the period (full scale = 1)
+    float peak;             // Largest |sample|
+    uint32_t crossings;     // Zero crossings
+    uint32_t frames;        // Samples in the period
+    float tonality;         // 1 - spectral flatness of the bank at the period end (0: noise/silence)
+    float peak_hz;          // Strongest bank frequency
+    uint64_t captured_ns;   // CLOCK_MONOTONIC when the period's last sample was captured
+} AudioSummary;
+
+/**
+ * @brief Running sums of a period that may arrive in several pieces
+ *        (an mmap area wraps at the end of the device buffer).
+ */
+typedef struct {
+    float sum_sq;
+    float peak;
+    uint32_t crossings;
+    uint32_t frames;
+    short last;             // Last sample seen (zero-crossing state)
+} AudioAccum;
+
+/*
+ * Spectral stage: a Goertzel filter bank at golden-ratio harmonics.
+ *
+ * Bin k sits at AUDIO_BANK_BASE_HZ · phi^(k/3), so every third bin is a
+ * harmonic base · phi^n and the thirds in between keep any tone from
+ * 110 Hz to ~4.4 kHz near a bin. Samples stream through two Hann-windowed
+ * frames of AUDIO_SPECTRUM_N offset by half a frame (50% overlap, which
+ * the periodic Hann window sums to a constant), so no sample history is
+ * kept: each sample is windowed into both frames as it arrives. One frame
+ * completes every AUDIO_SPECTRUM_HOP samples, i.e. once per capture period.
+ *
+ * Bin powers are smoothed across frames, and the spectral flatness
+ * (geometric over arithmetic mean of the powers) gives the tonality
+ * 1 - flatness: near 0 for broadband noise and silence, near 1 when the
+ * energy sits in a few bins. The Goertzel recurrences of all bins run
+ * side by side in structure-of-arrays form, one vector pass per sample.
+ */
+#define AUDIO_SPECTRUM_N 512
+#define AUDIO_SPECTRUM_HOP 256
+#define AUDIO_BANK_BINS 24          // Multiple of 8: the bin loop vectorizes without a tail
+#define AUDIO_BANK_BASE_HZ 110.0f
+#define AUDIO_SPECTRUM_SMOOTH 0.3f  // Weight of the newest frame in the bin powers
+
+typedef struct {
+    _Alignas(32) float window[AUDIO_SPECTRUM_N];  // Periodic Hann, scaled to full scale = 1
+    _Alignas(32) float coef[AUDIO_BANK_BINS];     // 2·cos(2·pi·f/rate)
+    _Alignas(32) float s1[2][AUDIO_BANK_BINS];    // Goertzel state, one set per frame in flight
+    _Alignas(32) float s2[2][AUDIO_BANK_BINS];
+    _Alignas(32) float power[AUDIO_BANK_BINS];    // Smoothed bin powers
+    float hz[AUDIO_BANK_BINS];
+    int32_t pos[2];         // Position in each frame (< 0: not started yet)
+    int bins;               // Bins below Nyquist
+    float flatness;
+    float tonality;
+    float peak_hz;
+    uint64_t frames;        // Frames completed
+} AudioSpectrum;
+
+/**
+ * @brief Mic-to-state latency of the summaries applied so far.
+ */
+typedef struct {
+    uint64_t periods;       // Summaries applied
+    uint64_t last_ns;
+    uint64_t max_ns;
+    double mean_ns;
+} AudioLatency;
+
+/**
+ * @brief Analyze one block of mono S16 samples and fold it into the
+ *        system state (audio_energy RMS EMA, audio_coherence).
+ *        Device independent: shared by the ALSA HAL and the benchmarks.
+ * @param state Pointer to the SystemState to update.
+ * @param sp Spectral state of the stream the block belongs to.
+ * @param samples Interleaved mono S16 samples.
+ * @param frames Number of samples (<= 0 leaves the state untouched).
+ */
+void hal_audio_analyze(SystemState *state, AudioSpectrum *sp, const short *samples, int frames);
+
+/**
+ * @brief Set up the bank for a sample rate (bins above 0.45 · rate are dropped).
+ * @return 0, or -1 if the rate leaves no bins.
+ */
+int hal_audio_spectrum_init(AudioSpectrum *sp, float rate);
+
+/**
+ * @brief Restart the stream: frames in flight and smoothed powers cleared.
+ */
+void hal_audio_spectrum_reset(AudioSpectrum *sp);
+
+/**
+ * @brief Stream samples through the bank.
+ * @return Frames completed (tonality and peak_hz updated after each).
+ */
+uint32_t hal_audio_spectrum_feed(AudioSpectrum *sp, const short *samples, int frames);
+
+void hal_audio_accum_reset(AudioAccum *acc);
+void hal_audio_accumulate(AudioAccum *acc, const short *samples, int frames);
+
+/**
+ * @brief Close the period in acc (sums restart, the crossing state carries on).
+ * @return 0, or -1 if acc holds no samples.
+ */
+int hal_audio_summarize(AudioAccum *acc, AudioSummary *out);
+
+/**
+ * @brief Fold one period's features into the state: audio_energy follows
+ *        the RMS; audio_coherence follows the tonality while the level is
+ *        above the noise gate and decays otherwise. The EMA weights are
+ *        scaled to summary->frames, so the time constants per second are
+ *        those of the original 1024-sample blocks (0.9/0.1 energy,
+ *        0.95/0.05 coherence, 0.99 decay) at any period length.
+ */
+void hal_audio_apply(SystemState *state, const AudioSummary *summary);
+
+/**
+ * @brief Consumer side of the capture ring: apply every queued summary in
+ *        order and record its latency against now_ns. Never blocks.
+ * @return Summaries applied.
+ */
+uint32_t hal_audio_drain(SystemState *state, QcoreRing *ring, uint64_t now_ns, AudioLatency *lat);
+
+#endif // HAL_AUDIO_DSP_H
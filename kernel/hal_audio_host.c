@@ -1,68 +1,187 @@
 #include <alsa/asoundlib.h>
-#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
 #include "hal_audio_host.h"
+#include "hal_audio_dsp.h"
+
+#define AUDIO_RATE 44100u
+#define AUDIO_PERIOD_FRAMES 256u    // ~5.8 ms at 44.1 kHz
+#define AUDIO_PERIODS 4u
+#define AUDIO_RING_SLOTS 64u        // Power of two; ~370 ms of summaries
+#define AUDIO_WAIT_MS 100           // Bounds how long stop takes to be seen
 
 static snd_pcm_t *capture_handle = NULL;
-static short buffer[1024];
+static pthread_t capture_thread;
+static _Atomic int capture_stop;
+static _Atomic uint64_t capture_periods;
+static _Atomic uint64_t capture_xruns;
+static _Atomic uint64_t capture_dropped;
 
-int hal_audio_init() {
+static QcoreRing summary_ring;
+static AudioSummary summary_slots[AUDIO_RING_SLOTS];
+static AudioLatency latency;        // Consumer side only
+static AudioSpectrum spectrum;      // Capture thread only
+static unsigned int capture_rate = AUDIO_RATE;
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int configure(snd_pcm_t *pcm, unsigned int *rate) {
+    snd_pcm_hw_params_t *hw;
+    snd_pcm_sw_params_t *sw;
+    *rate = AUDIO_RATE;
+    snd_pcm_uframes_t period = AUDIO_PERIOD_FRAMES;
+    snd_pcm_uframes_t buffer = AUDIO_PERIOD_FRAMES * AUDIO_PERIODS;
     int err;
-    if ((err = snd_pcm_open(&capture_handle, "default", SND_PCM_STREAM_CAPTURE, SND_PCM_NONBLOCK)) < 0) {
-        fprintf(stderr, "Cannot open audio device: %s\n", snd_strerror(err));
+
+    snd_pcm_hw_params_alloca(&hw);
+    if ((err = snd_pcm_hw_params_any(pcm, hw)) < 0 ||
+        (err = snd_pcm_hw_params_set_access(pcm, hw, SND_PCM_ACCESS_MMAP_INTERLEAVED)) < 0 ||
+        (err = snd_pcm_hw_params_set_format(pcm, hw, SND_PCM_FORMAT_S16_LE)) < 0 ||
+        (err = snd_pcm_hw_params_set_channels(pcm, hw, 1)) < 0 ||
+        (err = snd_pcm_hw_params_set_rate_near(pcm, hw, rate, NULL)) < 0 ||
+        (err = snd_pcm_hw_params_set_period_size_near(pcm, hw, &period, NULL)) < 0 ||
+        (err = snd_pcm_hw_params_set_buffer_size_near(pcm, hw, &buffer)) < 0 ||
+        (err = snd_pcm_hw_params(pcm, hw)) < 0) {
+        fprintf(stderr, "ALSA hw_params error: %s\n", snd_strerror(err));
         return -1;
     }
 
-    if ((err = snd_pcm_set_params(capture_handle,
-                                 SND_PCM_FORMAT_S16_LE,
-                                 SND_PCM_ACCESS_RW_INTERLEAVED,
-                                 1,
-                                 44100,
-                                 1,
-                                 500000)) < 0) { // 0.5s latency
-        fprintf(stderr, "ALSA set_params error: %s\n", snd_strerror(err));
+    // Wake once per period
+    snd_pcm_sw_params_alloca(&sw);
+    if ((err = snd_pcm_sw_params_current(pcm, sw)) < 0 ||
+        (err = snd_pcm_sw_params_set_avail_min(pcm, sw, period)) < 0 ||
+        (err = snd_pcm_sw_params(pcm, sw)) < 0) {
+        fprintf(stderr, "ALSA sw_params error: %s\n", snd_strerror(err));
         return -1;
     }
-
     return 0;
 }
 
-void hal_audio_poll(SystemState *state) {
-    if (!capture_handle) return;
+static void recover(snd_pcm_t *pcm, int err) {
+    if (err == -EPIPE) atomic_fetch_add_explicit(&capture_xruns, 1, memory_order_relaxed);
+    if (snd_pcm_recover(pcm, err, 1) == 0) snd_pcm_start(pcm);
+}
 
-    int frames = snd_pcm_readi(capture_handle, buffer, 1024);
-    if (frames < 0) {
-        if (frames == -EPIPE) snd_pcm_prepare(capture_handle);
+static void publish(AudioAccum *acc, uint64_t captured_ns) {
+    AudioSummary summary;
+    if (hal_audio_summarize(acc, &summary) != 0) return;
+    summary.captured_ns = captured_ns;
+    summary.tonality = spectrum.tonality;
+    summary.peak_hz = spectrum.peak_hz;
+    if (qcore_ring_push(&summary_ring, &summary) != 0) {
+        atomic_fetch_add_explicit(&capture_dropped, 1, memory_order_relaxed);
         return;
     }
+    atomic_fetch_add_explicit(&capture_periods, 1, memory_order_relaxed);
+}
+
+static void *capture_main(void *unused) {
+    (void)unused;
+    snd_pcm_t *pcm = capture_handle;
+    AudioAccum acc;
+    hal_audio_accum_reset(&acc);
+
+    while (!atomic_load_explicit(&capture_stop, memory_order_acquire)) {
+        snd_pcm_sframes_t avail = snd_pcm_avail_update(pcm);
+        if (avail < 0) {
+            recover(pcm, (int)avail);
+            continue;
+        }
+        if ((snd_pcm_uframes_t)avail < AUDIO_PERIOD_FRAMES) {
+            int err = snd_pcm_wait(pcm, AUDIO_WAIT_MS);
+            if (err < 0) recover(pcm, err);
+            continue;
+        }
 
-    float sum_sq = 0;
-    int crossings = 0;
-    short last_val = 0;
+        // Read the device buffer in place, one period at a time; a period
+        // may arrive in two pieces where the mmap area wraps
+        snd_pcm_uframes_t left = (snd_pcm_uframes_t)avail;
+        while (left > 0) {
+            const snd_pcm_channel_area_t *areas;
+            snd_pcm_uframes_t offset;
+            snd_pcm_uframes_t frames = AUDIO_PERIOD_FRAMES - acc.frames;
+            if (frames > left) frames = left;
+            int err = snd_pcm_mmap_begin(pcm, &areas, &offset, &frames);
+            if (err < 0 || frames == 0) {
+                if (err < 0) recover(pcm, err);
+                break;
+            }
+            const short *samples = (const short *)((const unsigned char *)areas[0].addr +
+                                                   areas[0].first / 8 + offset * areas[0].step / 8);
+            hal_audio_accumulate(&acc, samples, (int)frames);
+            hal_audio_spectrum_feed(&spectrum, samples, (int)frames);
+            snd_pcm_sframes_t done = snd_pcm_mmap_commit(pcm, offset, frames);
+            if (done < 0 || (snd_pcm_uframes_t)done != frames) {
+                recover(pcm, done < 0 ? (int)done : -EPIPE);
+                break;
+            }
+            left -= frames;
 
-    for (int i = 0; i < frames; i++) {
-        float val = buffer[i] / 32768.0f;
-        sum_sq += val * val;
-        
-        if ((buffer[i] > 0 && last_val <= 0) || (buffer[i] < 0 && last_val >= 0)) {
-            crossings++;
+            // The period's last sample is `left` frames older than now
+            if (acc.frames >= AUDIO_PERIOD_FRAMES) {
+                publish(&acc, monotonic_ns() - (uint64_t)left * 1000000000ull / capture_rate);
+            }
         }
-        last_val = buffer[i];
+    }
+    return NULL;
+}
+
+int hal_audio_init() {
+    int err;
+    if ((err = snd_pcm_open(&capture_handle, "default", SND_PCM_STREAM_CAPTURE, 0)) < 0) {
+        fprintf(stderr, "Cannot open audio device: %s\n", snd_strerror(err));
+        capture_handle = NULL;
+        return -1;
+    }
+
+    if (configure(capture_handle, &capture_rate) != 0 ||
+        hal_audio_spectrum_init(&spectrum, (float)capture_rate) != 0) {
+        snd_pcm_close(capture_handle);
+        capture_handle = NULL;
+        return -1;
     }
 
-    float rms = sqrtf(sum_sq / (float)frames);
-    state->audio_energy = (0.9f * state->audio_energy) + (0.1f * rms);
+    qcore_ring_init(&summary_ring, summary_slots, sizeof(AudioSummary), AUDIO_RING_SLOTS);
+    memset(&latency, 0, sizeof(latency));
+    atomic_store(&capture_periods, 0);
+    atomic_store(&capture_xruns, 0);
+    atomic_store(&capture_dropped, 0);
+    atomic_store(&capture_stop, 0);
 
-    // Simple Coherence: Stability of zero-crossings
-    // A stable whistle or tone will have high coherence
-    if (rms > 0.05f) {
-        state->audio_coherence = (0.95f * state->audio_coherence) + 0.05f;
-    } else {
-        state->audio_coherence *= 0.99f;
+    if ((err = snd_pcm_start(capture_handle)) < 0 ||
+        (err = pthread_create(&capture_thread, NULL, capture_main, NULL)) != 0) {
+        fprintf(stderr, "Cannot start audio capture: %s\n", err < 0 ? snd_strerror(err) : strerror(err));
+        snd_pcm_close(capture_handle);
+        capture_handle = NULL;
+        return -1;
     }
+
+    return 0;
+}
+
+void hal_audio_poll(SystemState *state) {
+    if (!capture_handle) return;
+    hal_audio_drain(state, &summary_ring, monotonic_ns(), &latency);
+}
+
+void hal_audio_stats(AudioCaptureStats *out) {
+    out->periods = atomic_load_explicit(&capture_periods, memory_order_relaxed);
+    out->xruns = atomic_load_explicit(&capture_xruns, memory_order_relaxed);
+    out->dropped = atomic_load_explicit(&capture_dropped, memory_order_relaxed);
+    out->latency = latency;
 }
 
 void hal_audio_cleanup() {
     if (capture_handle) {
+        atomic_store_explicit(&capture_stop, 1, memory_order_release);
+        pthread_join(capture_thread, NULL);
+        snd_pcm_drop(capture_handle);
         snd_pcm_close(capture_handle);
         capture_handle = NULL;
     }
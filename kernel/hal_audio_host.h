@@ -2,21 +2,40 @@
 #define HAL_AUDIO_HOST_H
 
 #include "qcore_metriplectic.h"
+#include "hal_audio_dsp.h"
 
 /**
- * @brief Initialize ALSA audio capture on the host.
+ * @brief Capture thread counters and the mic-to-state latency seen by
+ *        hal_audio_poll().
+ */
+typedef struct {
+    uint64_t periods;       // Summaries queued by the capture thread
+    uint64_t xruns;         // Overruns recovered
+    uint64_t dropped;       // Summaries lost to a full ring (poll not keeping up)
+    AudioLatency latency;
+} AudioCaptureStats;
+
+/**
+ * @brief Initialize ALSA audio capture on the host and start the capture
+ *        thread (mmap access, 256-frame periods at 44.1 kHz).
  * @return 0 on success, -1 on failure.
  */
 int hal_audio_init();
 
 /**
- * @brief Poll audio device for latest samples and update system state.
+ * @brief Apply the periods captured since the last call to the system
+ *        state. Never blocks.
  * @param state Pointer to the SystemState to update.
  */
 void hal_audio_poll(SystemState *state);
 
 /**
- * @brief Cleanup ALSA resources.
+ * @brief Snapshot of the capture counters. Call from the polling thread.
+ */
+void hal_audio_stats(AudioCaptureStats *out);
+
+/**
+ * @brief Stop the capture thread and release ALSA resources.
  */
 void hal_audio_cleanup();
 
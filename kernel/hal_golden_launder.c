@@ -25,6 +25,10 @@ static float apply_voltage_correction(GoldenLaunder *launder) {
 }
 
 float hal_launder_step(GoldenLaunder *launder, float t) {
+    return hal_launder_step_on(launder, t, golden_operator(t));
+}
+
+float hal_launder_step_on(GoldenLaunder *launder, float t, float on) {
     launder->step_count++;
     
     // 1. Compute quasiperiodic threshold based on Golden Operator modulation
@@ -32,7 +36,7 @@ float hal_launder_step(GoldenLaunder *launder, float t) {
     float threshold = k_cos(PI * duty);
     
     // 2. Quasiperiodic PWM pulse (Reduced to 1Hz for simulation stability)
-    float phase_mod = golden_operator(t) * PI;
+    float phase_mod = on * PI;
     launder->last_v = (k_cos(t * PI * 2.0f + phase_mod) > threshold) ? 5.0f : 0.0f;
     
     // 3. Update rolling RMS (using exponential moving average for V^2)
@@ -19,5 +19,6 @@ typedef struct {
 // HAL API
 void hal_launder_init(GoldenLaunder *launder);
 float hal_launder_step(GoldenLaunder *launder, float t);
+float hal_launder_step_on(GoldenLaunder *launder, float t, float on); // on: golden_operator(t) from the caller
 
 #endif // HAL_GOLDEN_LAUNDER_H
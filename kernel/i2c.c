@@ -1,19 +1,185 @@
 #include "i2c.h"
+#include "io.h"
+#include "tsc.h"
+#ifdef I2C_SERIAL_TRACE
+#include "uart.h"
+#endif
 
-extern void serial_print(const char *s);
-extern void serial_putc(char c);
+#define PIIX4_VENDOR 0x8086
+#define PIIX4_SMBUS_DEVICE 0x7113
+#define PIIX4_SMBBA 0x90        // SMBus base address (I/O space, bits 15:4)
+#define PIIX4_SMBHSTCFG 0xD2    // Bit 0: host interface enable
+#define PIIX4_DEFAULT_BASE 0xB100   // Where SeaBIOS puts it, if nobody did
 
-void i2c_write_byte(uint8_t addr, uint8_t val) {
-    // Simulated I2C communication over Serial
-    // In a physical x86 system, this would use the PIIX4 SMBus I/O ports (usually 0x400-0x40F)
-    
+// Host registers, offsets from the I/O base
+#define SMB_HST_STS 0x00
+#define SMB_HST_CNT 0x02
+#define SMB_HST_CMD 0x03
+#define SMB_HST_ADD 0x04
+#define SMB_HST_D0 0x05
+#define SMB_HST_D1 0x06
+#define SMB_BLOCK_DB 0x07
+
+// HST_STS bits (write 1 to clear)
+#define STS_HOST_BUSY 0x01
+#define STS_INTR 0x02           // Transaction completed
+#define STS_DEV_ERR 0x04        // NAK, bad protocol or timeout
+#define STS_BUS_ERR 0x08        // Collision
+#define STS_FAILED 0x10         // Killed
+#define STS_DONE (STS_INTR | STS_DEV_ERR | STS_BUS_ERR | STS_FAILED)
+
+// HST_CNT: protocol in bits 4:2, START kicks it off
+#define CNT_BYTE 0x04
+#define CNT_BYTE_DATA 0x08
+#define CNT_WORD_DATA 0x0C
+#define CNT_BLOCK 0x14
+#define CNT_START 0x40
+
+#define SMB_TIMEOUT_US 40000u   // A full block at the 10 kHz SMBus minimum takes ~32 ms
+
+static uint16_t smb_base;
+static uint32_t transactions;
+static uint32_t bytes;
+static uint32_t errors;
+
+uint16_t i2c_init(void) {
+    for (uint8_t dev = 0; dev < 32; dev++) {
+        for (uint8_t func = 0; func < 8; func++) {
+            uint32_t id = pci_config_read(0, dev, func, 0x00);
+            if ((id & 0xFFFF) != PIIX4_VENDOR || (id >> 16) != PIIX4_SMBUS_DEVICE) continue;
+
+            uint16_t base = (uint16_t)(pci_config_read(0, dev, func, PIIX4_SMBBA) & 0xFFF0);
+            if (base == 0) {
+                base = PIIX4_DEFAULT_BASE;
+                pci_config_write(0, dev, func, PIIX4_SMBBA, base | 0x1);
+            }
+            // Host interface on (interrupts stay off: we poll), I/O decode on
+            uint32_t hstcfg = pci_config_read(0, dev, func, PIIX4_SMBHSTCFG);
+            pci_config_write(0, dev, func, PIIX4_SMBHSTCFG, hstcfg | (1u << 16));
+            uint32_t command = pci_config_read(0, dev, func, 0x04);
+            pci_config_write(0, dev, func, 0x04, command | 0x1);
+
+            smb_base = base;
+            outb(smb_base + SMB_HST_STS, STS_DONE);
+            return smb_base;
+        }
+    }
+    return 0;
+}
+
+// Run the transaction set up in the host registers and poll it to completion
+static int smb_transaction(uint8_t protocol) {
+    transactions++;
+    uint64_t deadline = rdtsc() + (uint64_t)SMB_TIMEOUT_US * tsc_ticks_per_us();
+
+    while (inb(smb_base + SMB_HST_STS) & STS_HOST_BUSY) {
+        if (rdtsc() > deadline) { errors++; return -1; }
+    }
+    outb(smb_base + SMB_HST_STS, STS_DONE);
+    outb(smb_base + SMB_HST_CNT, protocol | CNT_START);
+
+    uint8_t status;
+    do {
+        status = inb(smb_base + SMB_HST_STS);
+        if (rdtsc() > deadline) {
+            outb(smb_base + SMB_HST_CNT, 0x02);     // KILL
+            status = STS_FAILED;
+            break;
+        }
+    } while ((status & STS_HOST_BUSY) || !(status & STS_DONE));
+    outb(smb_base + SMB_HST_STS, STS_DONE);
+
+    if (status & (STS_DEV_ERR | STS_BUS_ERR | STS_FAILED)) {
+        errors++;
+        return -1;
+    }
+    return 0;
+}
+
+#ifdef I2C_SERIAL_TRACE
+// One write per line: a full TX ring drops the line, never half of it
+static void trace(uint8_t addr, const uint8_t *buf, uint32_t len) {
     static const char *hex = "0123456789ABCDEF";
-    
-    serial_print("[I2C] ");
-    serial_putc(hex[(addr >> 4) & 0xF]);
-    serial_putc(hex[addr & 0xF]);
-    serial_print(" -> ");
-    serial_putc(hex[(val >> 4) & 0xF]);
-    serial_putc(hex[val & 0xF]);
-    serial_print("\n");
+    char line[6 + 2 + 3 + 16 * 3 + 4 + 2];
+    uint32_t n = 0;
+    const char *prefix = "[I2C] ";
+    while (*prefix) line[n++] = *prefix++;
+    line[n++] = hex[(addr >> 4) & 0xF];
+    line[n++] = hex[addr & 0xF];
+    line[n++] = ' ';
+    line[n++] = '<';
+    line[n++] = '-';
+    for (uint32_t i = 0; i < len && i < 16; i++) {
+        line[n++] = ' ';
+        line[n++] = hex[(buf[i] >> 4) & 0xF];
+        line[n++] = hex[buf[i] & 0xF];
+    }
+    if (len > 16) {
+        line[n++] = ' ';
+        line[n++] = '.';
+        line[n++] = '.';
+        line[n++] = '.';
+    }
+    line[n++] = '\n';
+    uart_write(line, n);
+}
+#endif
+
+int i2c_write_buf(uint8_t addr, const uint8_t *buf, uint32_t len) {
+#ifdef I2C_SERIAL_TRACE
+    trace(addr, buf, len);
+#endif
+    if (!smb_base) {
+        errors++;
+        return -1;
+    }
+
+    outb(smb_base + SMB_HST_ADD, (uint8_t)(addr << 1));    // R/W bit 0: write
+    while (len > 0) {
+        // No count byte on the wire: send byte, write byte, write word
+        uint32_t chunk = (len >= 3) ? 3 : len;
+        static const uint8_t protocols[] = {0, CNT_BYTE, CNT_BYTE_DATA, CNT_WORD_DATA};
+        outb(smb_base + SMB_HST_CMD, buf[0]);
+        if (chunk > 1) outb(smb_base + SMB_HST_D0, buf[1]);
+        if (chunk > 2) outb(smb_base + SMB_HST_D1, buf[2]);
+        if (smb_transaction(protocols[chunk]) != 0) return -1;
+        bytes += chunk;
+        buf += chunk;
+        len -= chunk;
+    }
+    return 0;
+}
+
+int i2c_smbus_block_write(uint8_t addr, uint8_t cmd, const uint8_t *buf, uint32_t len) {
+    if (!smb_base || len == 0 || len > I2C_BLOCK_MAX) {
+        errors++;
+        return -1;
+    }
+
+    outb(smb_base + SMB_HST_ADD, (uint8_t)(addr << 1));
+    outb(smb_base + SMB_HST_CMD, cmd);
+    outb(smb_base + SMB_HST_D0, (uint8_t)len);
+    (void)inb(smb_base + SMB_HST_CNT);                      // Rewinds the block buffer index
+    for (uint32_t i = 0; i < len; i++) {
+        outb(smb_base + SMB_BLOCK_DB, buf[i]);
+    }
+    if (smb_transaction(CNT_BLOCK) != 0) return -1;
+    bytes += len + 2;
+    return 0;
+}
+
+void i2c_write_byte(uint8_t addr, uint8_t val) {
+    i2c_write_buf(addr, &val, 1);
+}
+
+uint32_t i2c_transactions(void) {
+    return transactions;
+}
+
+uint32_t i2c_bytes(void) {
+    return bytes;
+}
+
+uint32_t i2c_errors(void) {
+    return errors;
 }
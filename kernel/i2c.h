@@ -1,5 +1,45 @@
 #ifndef I2C_H
 #define I2C_H
+
 #include <stdint.h>
+
+/*
+ * I2C writes through the PIIX4 SMBus host controller (kernel only), the
+ * one QEMU's i440FX machine emulates at 00:01.3.
+ *
+ * i2c_write_buf() puts the bytes on the wire exactly as given, up to
+ * three per SMBus transaction (send byte / write byte / write word), so
+ * a PCF8574-style expander latches each one in turn. i2c_smbus_block_write()
+ * is the SMBus block protocol proper; the command and count bytes go out
+ * ahead of the data.
+ *
+ * Build with -DI2C_SERIAL_TRACE to also log every write to COM1.
+ */
+
+#define I2C_BLOCK_MAX 32u
+
+/**
+ * @brief Find the PIIX4 SMBus function on PCI bus 0 and enable it.
+ * @return The controller's I/O base, or 0 if there is none (writes then fail).
+ */
+uint16_t i2c_init(void);
+
+/**
+ * @brief Write len raw bytes to the 7-bit address addr.
+ * @return 0 on success, -1 on NAK, bus error, timeout or no controller.
+ */
+int i2c_write_buf(uint8_t addr, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief SMBus block write: cmd, len, then len (<= I2C_BLOCK_MAX) bytes.
+ * @return 0 on success, -1 on failure.
+ */
+int i2c_smbus_block_write(uint8_t addr, uint8_t cmd, const uint8_t *buf, uint32_t len);
+
 void i2c_write_byte(uint8_t addr, uint8_t val);
-#endif
+
+uint32_t i2c_transactions(void);    // SMBus transactions started since boot
+uint32_t i2c_bytes(void);           // Payload bytes written since boot
+uint32_t i2c_errors(void);          // Transactions that failed
+
+#endif // I2C_H
@@ -1,14 +1,15 @@
 #include "i2c_lcd.h"
-
-// External prototypes for delay and I2C
-extern void i2c_write_byte(uint8_t addr, uint8_t val);
-
-void k_delay_ms(uint32_t ms) {
-    for (volatile uint32_t i = 0; i < ms * 4000; i++); // Very rough approximation for QEMU
-}
-
-void k_delay_us(uint32_t us) {
-    for (volatile uint32_t i = 0; i < us * 4; i++); // Very rough approximation
+#include "i2c.h"
+
+// Address the controller's counter moves to after a write at addr
+static uint8_t lcd_next_addr(const LcdI2c *lcd, uint8_t addr) {
+    if (lcd->display_function & LCD_2LINE) {
+        if (addr == 0x27) return 0x40;
+        if (addr >= 0x67) return 0x00;
+    } else if (addr >= 0x4F) {
+        return 0x00;
+    }
+    return (uint8_t)(addr + 1);
 }
 
 void lcd_init(LcdI2c *lcd, uint8_t addr, uint8_t cols, uint8_t rows) {
@@ -16,6 +17,11 @@ void lcd_init(LcdI2c *lcd, uint8_t addr, uint8_t cols, uint8_t rows) {
     lcd->cols = cols;
     lcd->rows = rows;
     lcd->backlight_val = LCD_BACKLIGHT;
+    lcd->shadow_on = 1;
+    lcd->cursor = 0;
+    lcd->hw_cursor = LCD_CURSOR_UNKNOWN;
+    lcd->chars_sent = 0;
+    lcd->chars_skipped = 0;
     
     lcd->display_function = LCD_4BITMODE | LCD_1LINE | LCD_5x8DOTS;
     if (rows > 1) {
@@ -61,17 +67,26 @@ void lcd_init(LcdI2c *lcd, uint8_t addr, uint8_t cols, uint8_t rows) {
 void lcd_clear(LcdI2c *lcd) {
     lcd_command(lcd, LCD_CLEARDISPLAY);
     k_delay_ms(2);
+    for (int i = 0; i < LCD_DDRAM_SIZE; i++) lcd->ddram[i] = ' ';
+    lcd->cursor = 0;
 }
 
 void lcd_home(LcdI2c *lcd) {
     lcd_command(lcd, LCD_RETURNHOME);
     k_delay_ms(2);
+    lcd->cursor = 0;
 }
 
+// Only moves the logical cursor; the address is sent by the next lcd_putc
+// that actually has to write
 void lcd_set_cursor(LcdI2c *lcd, uint8_t col, uint8_t row) {
     int row_offsets[] = { 0x00, 0x40, 0x14, 0x54 };
     if (row >= lcd->rows) row = lcd->rows - 1;
-    lcd_command(lcd, LCD_SETDDRAMADDR | (col + row_offsets[row]));
+    lcd->cursor = (uint8_t)((col + row_offsets[row]) & 0x7F);
+}
+
+void lcd_shadow(LcdI2c *lcd, uint8_t on) {
+    lcd->shadow_on = on;
 }
 
 void lcd_backlight(LcdI2c *lcd, uint8_t on) {
@@ -86,11 +101,39 @@ void lcd_print(LcdI2c *lcd, const char *str) {
 }
 
 void lcd_putc(LcdI2c *lcd, char c) {
+    uint8_t target = lcd->cursor;
+    lcd->cursor = lcd_next_addr(lcd, target);
+    if (lcd->shadow_on && lcd->ddram[target] == (uint8_t)c) {
+        lcd->chars_skipped++;
+        return;
+    }
+
+    if (lcd->hw_cursor != target) {
+        lcd_command(lcd, LCD_SETDDRAMADDR | target);
+    }
     lcd_send(lcd, (uint8_t)c, LCD_RS);
+    lcd->ddram[target] = (uint8_t)c;
+    lcd->hw_cursor = lcd->cursor;
+    lcd->chars_sent++;
 }
 
 void lcd_command(LcdI2c *lcd, uint8_t value) {
     lcd_send(lcd, value, 0);
+
+    // Follow the controller's address counter (the highest set bit is the opcode)
+    if (value & LCD_SETDDRAMADDR) {
+        lcd->hw_cursor = value & 0x7F;
+    } else if (value & LCD_SETCGRAMADDR) {
+        lcd->hw_cursor = LCD_CURSOR_UNKNOWN;
+    } else if (value & LCD_FUNCTIONSET) {
+        // No effect on the address
+    } else if (value & LCD_CURSORSHIFT) {
+        lcd->hw_cursor = LCD_CURSOR_UNKNOWN;
+    } else if (value & (LCD_DISPLAYCONTROL | LCD_ENTRYMODESET)) {
+        // No effect on the address
+    } else if (value & (LCD_RETURNHOME | LCD_CLEARDISPLAY)) {
+        lcd->hw_cursor = 0;
+    }
 }
 
 void lcd_send(LcdI2c *lcd, uint8_t value, uint8_t mode) {
@@ -100,9 +143,16 @@ void lcd_send(LcdI2c *lcd, uint8_t value, uint8_t mode) {
     lcd_write4bits(lcd, lownib | mode);
 }
 
+// Set up the nibble, raise EN, drop EN: one bus transaction. Each byte
+// takes ~90 us on the wire, far above the 450 ns EN pulse minimum.
 void lcd_write4bits(LcdI2c *lcd, uint8_t value) {
-    lcd_expander_write(lcd, value);
-    lcd_pulse_enable(lcd, value);
+    uint8_t seq[3] = {
+        (uint8_t)(value | lcd->backlight_val),
+        (uint8_t)(value | LCD_EN | lcd->backlight_val),
+        (uint8_t)((value & ~LCD_EN) | lcd->backlight_val)
+    };
+    i2c_write_buf(lcd->addr, seq, 3);
+    k_delay_us(50);
 }
 
 void lcd_expander_write(LcdI2c *lcd, uint8_t data) {
@@ -110,8 +160,10 @@ void lcd_expander_write(LcdI2c *lcd, uint8_t data) {
 }
 
 void lcd_pulse_enable(LcdI2c *lcd, uint8_t data) {
-    lcd_expander_write(lcd, data | LCD_EN);
-    k_delay_us(1);
-    lcd_expander_write(lcd, data & ~LCD_EN);
+    uint8_t seq[2] = {
+        (uint8_t)(data | LCD_EN | lcd->backlight_val),
+        (uint8_t)((data & ~LCD_EN) | lcd->backlight_val)
+    };
+    i2c_write_buf(lcd->addr, seq, 2);
     k_delay_us(50);
 }
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include "tsc.h"
 
 // commands
 #define LCD_CLEARDISPLAY 0x01
@@ -50,6 +51,16 @@
 #define LCD_RW 0x02  // Read/Write bit
 #define LCD_RS 0x01  // Register select bit
 
+#define LCD_DDRAM_SIZE 0x80       // Indexed by DDRAM address (7 bits)
+#define LCD_CURSOR_UNKNOWN 0xFF
+
+/*
+ * Shadowed output: ddram mirrors what the controller holds, so lcd_putc
+ * skips characters that are already on the glass and only sends
+ * SETDDRAMADDR when the controller's address counter is not already at
+ * the target (contiguous writes ride the auto-increment). Assumes the
+ * left-to-right, no-shift entry mode lcd_init sets up.
+ */
 typedef struct {
     uint8_t addr;
     uint8_t cols;
@@ -58,6 +69,12 @@ typedef struct {
     uint8_t display_function;
     uint8_t display_control;
     uint8_t display_mode;
+    uint8_t shadow_on;            // Skip writes that would not change the display
+    uint8_t cursor;               // DDRAM address of the next lcd_putc
+    uint8_t hw_cursor;            // Controller's address counter, or LCD_CURSOR_UNKNOWN
+    uint8_t ddram[LCD_DDRAM_SIZE];
+    uint32_t chars_sent;
+    uint32_t chars_skipped;
 } LcdI2c;
 
 // API
@@ -68,6 +85,7 @@ void lcd_set_cursor(LcdI2c *lcd, uint8_t col, uint8_t row);
 void lcd_backlight(LcdI2c *lcd, uint8_t on);
 void lcd_print(LcdI2c *lcd, const char *str);
 void lcd_putc(LcdI2c *lcd, char c);
+void lcd_shadow(LcdI2c *lcd, uint8_t on);   // On after lcd_init
 
 // Low-level commands
 void lcd_command(LcdI2c *lcd, uint8_t value);
@@ -76,8 +94,4 @@ void lcd_write4bits(LcdI2c *lcd, uint8_t value);
 void lcd_expander_write(LcdI2c *lcd, uint8_t data);
 void lcd_pulse_enable(LcdI2c *lcd, uint8_t data);
 
-// Delay utilities (must be provided or implemented in kernel)
-void k_delay_ms(uint32_t ms);
-void k_delay_us(uint32_t us);
-
 #endif // I2C_LCD_H
@@ -0,0 +1,127 @@
+#include "idt.h"
+#include "io.h"
+
+#define PIC1_CMD  0x20
+#define PIC1_DATA 0x21
+#define PIC2_CMD  0xA0
+#define PIC2_DATA 0xA1
+#define PIC_EOI   0x20
+#define PIC_READ_ISR 0x0B
+
+typedef struct {
+    uint16_t offset_lo;
+    uint16_t selector;
+    uint8_t zero;
+    uint8_t type_attr;      // 0x8E: present, ring 0, 32-bit interrupt gate
+    uint16_t offset_hi;
+} __attribute__((packed)) IdtGate;
+
+typedef struct {
+    uint16_t limit;
+    uint32_t base;
+} __attribute__((packed)) IdtPointer;
+
+static IdtGate idt[256] __attribute__((aligned(8)));
+static IrqHandler irq_handlers[16];
+
+void irq_dispatch(uint32_t vector);
+
+// One stub per PIC line: push the vector, save the general registers and
+// call irq_dispatch(vector) with the C calling convention
+__asm__(
+    ".text\n"
+    ".macro IRQ_STUB n\n"
+    "irq_stub_\\n:\n"
+    "    pushl $(32 + \\n)\n"
+    "    jmp irq_common\n"
+    ".endm\n"
+    "IRQ_STUB 0\n  IRQ_STUB 1\n  IRQ_STUB 2\n  IRQ_STUB 3\n"
+    "IRQ_STUB 4\n  IRQ_STUB 5\n  IRQ_STUB 6\n  IRQ_STUB 7\n"
+    "IRQ_STUB 8\n  IRQ_STUB 9\n  IRQ_STUB 10\n IRQ_STUB 11\n"
+    "IRQ_STUB 12\n IRQ_STUB 13\n IRQ_STUB 14\n IRQ_STUB 15\n"
+    "irq_common:\n"
+    "    pushal\n"
+    "    cld\n"
+    "    pushl 32(%esp)\n"      // The vector, above the 8 saved registers
+    "    call irq_dispatch\n"
+    "    addl $4, %esp\n"
+    "    popal\n"
+    "    addl $4, %esp\n"
+    "    iret\n"
+    ".section .rodata\n"
+    ".align 4\n"
+    "irq_stub_table:\n"
+    "    .long irq_stub_0, irq_stub_1, irq_stub_2, irq_stub_3\n"
+    "    .long irq_stub_4, irq_stub_5, irq_stub_6, irq_stub_7\n"
+    "    .long irq_stub_8, irq_stub_9, irq_stub_10, irq_stub_11\n"
+    "    .long irq_stub_12, irq_stub_13, irq_stub_14, irq_stub_15\n"
+    ".text\n"
+);
+extern const uint32_t irq_stub_table[16];
+
+static void idt_set_gate(int vector, uint32_t handler, uint16_t selector) {
+    idt[vector].offset_lo = (uint16_t)(handler & 0xFFFF);
+    idt[vector].selector = selector;
+    idt[vector].zero = 0;
+    idt[vector].type_attr = 0x8E;
+    idt[vector].offset_hi = (uint16_t)(handler >> 16);
+}
+
+static uint8_t pic_read_isr(uint16_t cmd_port) {
+    outb(cmd_port, PIC_READ_ISR);
+    return inb(cmd_port);
+}
+
+static void pic_remap(void) {
+    // ICW1: init + ICW4 follows; ICW2: vector offsets; ICW3: cascade on IRQ2;
+    // ICW4: 8086 mode
+    outb(PIC1_CMD, 0x11); io_wait();
+    outb(PIC2_CMD, 0x11); io_wait();
+    outb(PIC1_DATA, IRQ_BASE); io_wait();
+    outb(PIC2_DATA, IRQ_BASE + 8); io_wait();
+    outb(PIC1_DATA, 0x04); io_wait();
+    outb(PIC2_DATA, 0x02); io_wait();
+    outb(PIC1_DATA, 0x01); io_wait();
+    outb(PIC2_DATA, 0x01); io_wait();
+
+    // Everything masked except the cascade line
+    outb(PIC1_DATA, 0xFB);
+    outb(PIC2_DATA, 0xFF);
+}
+
+void idt_init(void) {
+    irq_disable();
+    // Multiboot leaves a flat code segment loaded but does not fix its selector
+    uint16_t cs;
+    __asm__ volatile ( "mov %%cs, %0" : "=r"(cs) );
+    for (int irq = 0; irq < 16; irq++) {
+        idt_set_gate(IRQ_BASE + irq, irq_stub_table[irq], cs);
+    }
+    IdtPointer ptr = { sizeof(idt) - 1, (uint32_t)idt };
+    __asm__ volatile ( "lidt %0" : : "m"(ptr) );
+    pic_remap();
+}
+
+void irq_install(int irq, IrqHandler handler) {
+    if (irq < 0 || irq > 15) return;
+    irq_handlers[irq] = handler;
+    uint16_t port = (irq < 8) ? PIC1_DATA : PIC2_DATA;
+    outb(port, inb(port) & (uint8_t)~(1u << (irq & 7)));
+}
+
+void irq_dispatch(uint32_t vector) {
+    int irq = (int)vector - IRQ_BASE;
+
+    // Spurious IRQ 7/15: no ISR bit set, no EOI owed (but the master
+    // still saw the cascade for 15)
+    if (irq == 7 && !(pic_read_isr(PIC1_CMD) & 0x80)) return;
+    if (irq == 15 && !(pic_read_isr(PIC2_CMD) & 0x80)) {
+        outb(PIC1_CMD, PIC_EOI);
+        return;
+    }
+
+    if (irq_handlers[irq]) irq_handlers[irq]();
+
+    if (irq >= 8) outb(PIC2_CMD, PIC_EOI);
+    outb(PIC1_CMD, PIC_EOI);
+}
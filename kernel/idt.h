@@ -0,0 +1,50 @@
+#ifndef IDT_H
+#define IDT_H
+
+#include <stdint.h>
+
+/*
+ * Interrupt descriptor table and 8259 PIC (kernel only).
+ *
+ * The two PICs are remapped to vectors IRQ_BASE..IRQ_BASE+15 so they no
+ * longer overlap the CPU exceptions, and every line starts masked.
+ * Handlers run with interrupts disabled on the interrupted stack; they
+ * must not touch x87/SSE state (only the general registers are saved).
+ */
+
+#define IRQ_BASE 32
+
+typedef void (*IrqHandler)(void);
+
+/**
+ * @brief Load the IDT and remap the PICs (all IRQs masked).
+ *        Interrupts stay disabled until irq_enable().
+ */
+void idt_init(void);
+
+/**
+ * @brief Route IRQ line irq (0..15) to handler and unmask it.
+ *        The end-of-interrupt is sent after the handler returns.
+ */
+void irq_install(int irq, IrqHandler handler);
+
+static inline void irq_enable(void) {
+    __asm__ volatile ( "sti" );
+}
+
+static inline void irq_disable(void) {
+    __asm__ volatile ( "cli" );
+}
+
+// Critical sections that may also run with interrupts already off
+static inline uint32_t irq_save(void) {
+    uint32_t flags;
+    __asm__ volatile ( "pushfl; popl %0; cli" : "=r"(flags) : : "memory" );
+    return flags;
+}
+
+static inline void irq_restore(uint32_t flags) {
+    if (flags & 0x200) irq_enable(); // IF was set
+}
+
+#endif // IDT_H
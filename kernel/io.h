@@ -0,0 +1,43 @@
+#ifndef IO_H
+#define IO_H
+
+#include <stdint.h>
+
+// x86 port I/O (kernel only)
+static inline void outb(uint16_t port, uint8_t val) {
+    __asm__ volatile ( "outb %0, %1" : : "a"(val), "Nd"(port) );
+}
+
+static inline uint8_t inb(uint16_t port) {
+    uint8_t ret;
+    __asm__ volatile ( "inb %1, %0" : "=a"(ret) : "Nd"(port) );
+    return ret;
+}
+
+static inline void outl(uint16_t port, uint32_t val) {
+    __asm__ volatile ( "outl %0, %1" : : "a"(val), "Nd"(port) );
+}
+
+static inline uint32_t inl(uint16_t port) {
+    uint32_t ret;
+    __asm__ volatile ( "inl %1, %0" : "=a"(ret) : "Nd"(port) );
+    return ret;
+}
+
+// PCI configuration mechanism #1: dword-aligned reads and writes
+static inline uint32_t pci_config_read(uint8_t bus, uint8_t dev, uint8_t func, uint8_t off) {
+    outl(0xCF8, 0x80000000u | ((uint32_t)bus << 16) | ((uint32_t)dev << 11) | ((uint32_t)func << 8) | (off & 0xFC));
+    return inl(0xCFC);
+}
+
+static inline void pci_config_write(uint8_t bus, uint8_t dev, uint8_t func, uint8_t off, uint32_t val) {
+    outl(0xCF8, 0x80000000u | ((uint32_t)bus << 16) | ((uint32_t)dev << 11) | ((uint32_t)func << 8) | (off & 0xFC));
+    outl(0xCFC, val);
+}
+
+// ~1us delay: a write to the unused POST port, for slow legacy devices (8259)
+static inline void io_wait(void) {
+    outb(0x80, 0);
+}
+
+#endif // IO_H
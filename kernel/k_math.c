@@ -0,0 +1,270 @@
+#include <stdint.h>
+#include "k_math.h"
+
+/*
+ * Cody-Waite reduction, x = k*pi/2 + r, without any loop.
+ * Accurate tier: pi/2 split into two doubles; PIO2_HI has 33 significant
+ * bits, so k * PIO2_HI is exact for |k| < 2^20 (|x| < K_TRIG_RANGE).
+ * Fast tier: three floats (Cephes split); exact products for |k| < 2^13
+ * (|x| < K_TRIG_RANGE_FAST).
+ */
+#define TWO_OVER_PI_D 6.36619772367581382433e-01
+#define PIO2_HI 1.57079632673412561417e+00
+#define PIO2_LO 6.07710050650619224932e-11
+
+#define TWO_OVER_PI 0.636619772367581f
+#define PIO2_1 1.5703125f
+#define PIO2_2 4.837512969970703125e-4f
+#define PIO2_3 7.54978995489188216e-8f
+
+// Arguments beyond this would overflow the int quadrant count
+#define K_TRIG_LIMIT 1.0e9f
+
+// ln 2 split the same way for exp
+#define LOG2E 1.44269504088896341f
+#define LN2_HI 0.693359375f
+#define LN2_LO -2.12194440e-4f
+#define EXP_MAX 88.7228391f
+#define EXP_MIN -87.3365448f
+
+typedef union {
+    float f;
+    uint32_t u;
+} FloatBits;
+
+static inline int round_to_int(float x) {
+    return (int)(x + ((x >= 0.0f) ? 0.5f : -0.5f));
+}
+
+/**
+ * @brief r = x - k*pi/2 with |r| <= pi/4; *quadrant = k mod 4.
+ *        Non-finite x yields NaN, huge finite x yields phase 0.
+ */
+static inline float trig_reduce_accurate(float x, int *quadrant) {
+    float ax = (x < 0.0f) ? -x : x;
+    if (!(ax <= K_TRIG_LIMIT)) {
+        *quadrant = 0;
+        return x - x;
+    }
+    double xd = (double)x;
+    double t = xd * TWO_OVER_PI_D;
+    int k = (int)(t + ((t >= 0.0) ? 0.5 : -0.5));
+    double kd = (double)k;
+    double r = (xd - kd * PIO2_HI) - kd * PIO2_LO;
+    *quadrant = k & 3;
+    return (float)r;
+}
+
+static inline float trig_reduce_fast(float x, int *quadrant) {
+    float ax = (x < 0.0f) ? -x : x;
+    if (!(ax <= K_TRIG_LIMIT)) {
+        *quadrant = 0;
+        return x - x;
+    }
+    int k = round_to_int(x * TWO_OVER_PI);
+    float kf = (float)k;
+    float r = x - kf * PIO2_1;
+    r -= kf * PIO2_2;
+    r -= kf * PIO2_3;
+    *quadrant = k & 3;
+    return r;
+}
+
+// Kernels on [-pi/4, pi/4], z = r*r
+static inline float sin_poly_accurate(float r, float z) {
+    return r + r * z * (-1.6666654611e-1f + z * (8.3321608736e-3f + z * -1.9515295891e-4f));
+}
+
+static inline float cos_poly_accurate(float z) {
+    return 1.0f - 0.5f * z + z * z * (4.166664568298827e-2f + z * (-1.388731625493765e-3f + z * 2.443315711809948e-5f));
+}
+
+static inline float sin_poly_fast(float r, float z) {
+    return r + r * z * (-1.6663405846e-1f + z * 8.1636278656e-3f);
+}
+
+static inline float cos_poly_fast(float z) {
+    return 1.0f + z * (-4.9977258033e-1f + z * 4.0481992805e-2f);
+}
+
+// Quadrant q rotates (s, c) by q * pi/2
+static inline void sincos_quadrant(int q, float s, float c, float *sin_out, float *cos_out) {
+    switch (q) {
+        case 0:  *sin_out = s;  *cos_out = c;  break;
+        case 1:  *sin_out = c;  *cos_out = -s; break;
+        case 2:  *sin_out = -s; *cos_out = -c; break;
+        default: *sin_out = -c; *cos_out = s;  break;
+    }
+}
+
+float k_mod_2pi(float x) {
+    int q;
+    float r = trig_reduce_accurate(x, &q);
+    // r lies in [-pi/4, pi/4]; add back the quadrant offset
+    r += (float)q * (PIO2_1 + PIO2_2);
+    if (r < 0.0f) r += 4.0f * (PIO2_1 + PIO2_2);
+    return r;
+}
+
+// --- Accurate tier ---
+
+float k_sin_accurate(float x) {
+    int q;
+    float r = trig_reduce_accurate(x, &q);
+    float z = r * r;
+    if (q & 1) {
+        float c = cos_poly_accurate(z);
+        return (q & 2) ? -c : c;
+    }
+    float s = sin_poly_accurate(r, z);
+    return (q & 2) ? -s : s;
+}
+
+float k_cos_accurate(float x) {
+    int q;
+    float r = trig_reduce_accurate(x, &q);
+    float z = r * r;
+    if (q & 1) {
+        float s = sin_poly_accurate(r, z);
+        return (q == 1) ? -s : s;
+    }
+    float c = cos_poly_accurate(z);
+    return (q & 2) ? -c : c;
+}
+
+void k_sincos_accurate(float x, float *s, float *c) {
+    int q;
+    float r = trig_reduce_accurate(x, &q);
+    float z = r * r;
+    sincos_quadrant(q, sin_poly_accurate(r, z), cos_poly_accurate(z), s, c);
+}
+
+static inline float exp_scale(float y, int k) {
+    FloatBits b;
+    b.u = (uint32_t)(k + 127) << 23;
+    return y * b.f;
+}
+
+float k_exp_accurate(float x) {
+    if (x != x) return x;
+    if (x > EXP_MAX) {
+        FloatBits inf;
+        inf.u = 0x7f800000u;
+        return inf.f;
+    }
+    if (x < EXP_MIN) return 0.0f; // Subnormal results flush to zero
+
+    int k = round_to_int(x * LOG2E);
+    float kf = (float)k;
+    float r = x - kf * LN2_HI;
+    r -= kf * LN2_LO;
+    float y = ((((( 1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r
+                + 4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f) * r * r + r + 1.0f;
+    // k can reach 128 at the top of the range: scale in two steps
+    if (k > 127) return exp_scale(y, k - 1) * 2.0f;
+    return exp_scale(y, k);
+}
+
+float k_sqrt_accurate(float x) {
+    if (!(x > 0.0f)) return 0.0f;
+    float r;
+#if defined(__SSE__)
+    __asm__("sqrtss %1, %0" : "=x"(r) : "x"(x));
+#elif defined(__i386__)
+    __asm__("fsqrt" : "=t"(r) : "0"(x));
+#else
+    FloatBits b;
+    b.f = x;
+    b.u = 0x1fbd1df5u + (b.u >> 1);
+    r = b.f;
+    for (int i = 0; i < 3; i++) r = 0.5f * (r + x / r);
+#endif
+    return r;
+}
+
+// --- Fast tier ---
+
+float k_sin_fast(float x) {
+    int q;
+    float r = trig_reduce_fast(x, &q);
+    float z = r * r;
+    if (q & 1) {
+        float c = cos_poly_fast(z);
+        return (q & 2) ? -c : c;
+    }
+    float s = sin_poly_fast(r, z);
+    return (q & 2) ? -s : s;
+}
+
+float k_cos_fast(float x) {
+    int q;
+    float r = trig_reduce_fast(x, &q);
+    float z = r * r;
+    if (q & 1) {
+        float s = sin_poly_fast(r, z);
+        return (q == 1) ? -s : s;
+    }
+    float c = cos_poly_fast(z);
+    return (q & 2) ? -c : c;
+}
+
+void k_sincos_fast(float x, float *s, float *c) {
+    int q;
+    float r = trig_reduce_fast(x, &q);
+    float z = r * r;
+    sincos_quadrant(q, sin_poly_fast(r, z), cos_poly_fast(z), s, c);
+}
+
+float k_exp_fast(float x) {
+    if (x != x) return x;
+    if (x > EXP_MAX) {
+        FloatBits inf;
+        inf.u = 0x7f800000u;
+        return inf.f;
+    }
+    if (x < EXP_MIN) return 0.0f;
+
+    int k = round_to_int(x * LOG2E);
+    float r = x - (float)k * (LN2_HI + LN2_LO);
+    float y = ((4.1900784566e-2f * r + 1.6754475017e-1f) * r + 4.9999120523e-1f) * r * r + r + 1.0f;
+    if (k > 127) return exp_scale(y, k - 1) * 2.0f;
+    return exp_scale(y, k);
+}
+
+float k_sqrt_fast(float x) {
+    if (!(x > 0.0f)) return 0.0f;
+    // Bit-level estimate (~3.5% error), then two Newton steps
+    FloatBits b;
+    b.f = x;
+    b.u = 0x1fbd1df5u + (b.u >> 1);
+    float r = b.f;
+    r = 0.5f * (r + x / r);
+    r = 0.5f * (r + x / r);
+    return r;
+}
+
+// --- Build-time tier ---
+
+#ifdef K_MATH_FAST
+#define K_TIER(fn) fn##_fast
+#else
+#define K_TIER(fn) fn##_accurate
+#endif
+
+float k_sin(float x) { return K_TIER(k_sin)(x); }
+float k_cos(float x) { return K_TIER(k_cos)(x); }
+void k_sincos(float x, float *s, float *c) { K_TIER(k_sincos)(x, s, c); }
+float k_exp(float x) { return K_TIER(k_exp)(x); }
+float k_sqrt(float x) { return K_TIER(k_sqrt)(x); }
+
+void k_sin_array(const float *x, float *out, int n) {
+    for (int i = 0; i < n; i++) out[i] = K_TIER(k_sin)(x[i]);
+}
+
+void k_cos_array(const float *x, float *out, int n) {
+    for (int i = 0; i < n; i++) out[i] = K_TIER(k_cos)(x[i]);
+}
+
+void k_sincos_array(const float *x, float *s, float *c, int n) {
+    for (int i = 0; i < n; i++) K_TIER(k_sincos)(x[i], &s[i], &c[i]);
+}
@@ -0,0 +1,54 @@
+#ifndef K_MATH_H
+#define K_MATH_H
+
+/*
+ * Freestanding math library (no libm, builds under Makefile.qemu).
+ *
+ * Every function comes in two accuracy tiers:
+ *   _accurate : <= 2 ulp for sin/cos (|x| < K_TRIG_RANGE) and exp; sqrt
+ *               correctly rounded where the FPU provides it.
+ *   _fast     : short polynomials, ~1.3e-5 absolute error for sin/cos
+ *               (|x| < K_TRIG_RANGE_FAST), ~1e-5 relative for exp.
+ * The unsuffixed names resolve to the tier chosen at build time:
+ * accurate by default, fast with -DK_MATH_FAST.
+ */
+
+/**
+ * @brief Largest |x| for which the Cody-Waite trig reduction stays exact
+ *        (per tier). Larger arguments still reduce in O(1), with an error
+ *        that grows with |x|.
+ */
+#define K_TRIG_RANGE 1048576.0f
+#define K_TRIG_RANGE_FAST 8192.0f
+
+// Build-time tier
+float k_sin(float x);
+float k_cos(float x);
+void k_sincos(float x, float *s, float *c);
+float k_exp(float x);
+float k_sqrt(float x);
+
+/**
+ * @brief Reduce x to [0, 2*PI) in constant time.
+ */
+float k_mod_2pi(float x);
+
+// Explicit tiers
+float k_sin_accurate(float x);
+float k_cos_accurate(float x);
+void k_sincos_accurate(float x, float *s, float *c);
+float k_exp_accurate(float x);
+float k_sqrt_accurate(float x);
+
+float k_sin_fast(float x);
+float k_cos_fast(float x);
+void k_sincos_fast(float x, float *s, float *c);
+float k_exp_fast(float x);
+float k_sqrt_fast(float x);
+
+// Array variants (build-time tier); out may alias x
+void k_sin_array(const float *x, float *out, int n);
+void k_cos_array(const float *x, float *out, int n);
+void k_sincos_array(const float *x, float *s, float *c, int n);
+
+#endif // K_MATH_H
@@ -1,11 +1,42 @@
 #include "qcore_metriplectic.h"
 #include "vga_driver.h"
 #include "i2c_lcd.h"
+#include "i2c.h"
 #include "banner.h"
+#include "idt.h"
+#include "pit.h"
+#include "uart.h"
+#include "tsc.h"
+#include "smp.h"
+#include "pmm.h"
+#include "arena.h"
+
+// Physics rate: one solve_step per PIT tick (-DKERNEL_TICK_HZ=N)
+#ifndef KERNEL_TICK_HZ
+#define KERNEL_TICK_HZ 60
+#endif
+
+// COM1 line rate (-DKERNEL_BAUD=N, at most UART_BAUD_MAX)
+#ifndef KERNEL_BAUD
+#define KERNEL_BAUD 115200
+#endif
+
+// Torus resolution (-DKERNEL_TORUS_DIM=N); the grid lives in the boot arena
+#ifndef KERNEL_TORUS_DIM
+#define KERNEL_TORUS_DIM TORUS_DIM
+#endif
+
+// Boot arena size (-DKERNEL_ARENA_MB=N), capped at half of free memory
+#ifndef KERNEL_ARENA_MB
+#define KERNEL_ARENA_MB 16
+#endif
 
 // Global state for predictability in the freestanding environment
 SystemState state;
 LcdI2c lcd;
+Arena arena;
+
+extern char _kernel_start[], _kernel_end[];     // linker.ld
 
 // Custom itoa for freestanding environment
 void itoa(int n, char s[]) {
@@ -26,41 +57,152 @@ void itoa(int n, char s[]) {
     }
 }
 
-// Port I/O
-static inline void outb(uint16_t port, uint8_t val) {
-    __asm__ volatile ( "outb %0, %1" : : "a"(val), "Nd"(port) );
+#ifdef KERNEL_SSE
+// The x87 build of the physics core, linked into the SSE kernel with its
+// symbols prefixed (see the sse target in Makefile.qemu)
+int x87_init_system(SystemState *state);
+void x87_solve_step(SystemState *state, float dt);
+void x87_release_system(SystemState *state);
+
+#define SSE_BENCH_STEPS 256u
+
+static uint32_t cycles_per_step(int (*init)(SystemState *), void (*step)(SystemState *, float),
+                                void (*release)(SystemState *)) {
+    static SystemState bench;
+    if (init(&bench) != 0) return 0;
+    step(&bench, 0.05f);    // Warm caches and branch predictors
+    uint64_t start = rdtsc();
+    for (uint32_t i = 0; i < SSE_BENCH_STEPS; i++) step(&bench, 0.05f);
+    uint32_t cycles = (uint32_t)(rdtsc() - start) / SSE_BENCH_STEPS;
+    release(&bench);
+    return cycles;
 }
-static inline uint8_t inb(uint16_t port) {
-    uint8_t ret;
-    __asm__ volatile ( "inb %1, %0" : "=a"(ret) : "Nd"(port) );
-    return ret;
+
+static void report_sse_speedup(void) {
+    uint32_t x87 = cycles_per_step(x87_init_system, x87_solve_step, x87_release_system);
+    uint32_t sse = cycles_per_step(init_system, solve_step, release_system);
+    char buf[12];
+    serial_print("[SSE] cycles/solve_step: x87 ");
+    itoa((int)x87, buf);
+    serial_print(buf);
+    serial_print(", SSE ");
+    itoa((int)sse, buf);
+    serial_print(buf);
+    serial_print(" (");
+    itoa(x87 ? (int)(sse * 100u / x87) : 0, buf);
+    serial_print(buf);
+    serial_print("% of x87)\n");
+}
+#endif
+
+static void *field_from_arena(void *ctx, size_t bytes, size_t align) {
+    return arena_alloc((Arena *)ctx, bytes, align);
 }
 
-void serial_putc(char c) {
-    while ((inb(0x3fd) & 0x20) == 0);
-    outb(0x3f8, c);
+static void field_to_arena(void *ctx, void *base, size_t bytes) {
+    arena_release((Arena *)ctx, base, bytes);
 }
-void serial_print(const char *s) {
-    while (*s) serial_putc(*s++);
+
+static void print_kb(const char *label, uint32_t kb) {
+    char buf[12];
+    serial_print(label);
+    itoa((int)kb, buf);
+    serial_print(buf);
+    serial_print(" KB");
+}
+
+static void report_memory(void) {
+    uint32_t total = pmm_frames_total();
+    uint32_t free = pmm_frames_free();
+    print_kb("[PMM] RAM ", total * (PMM_FRAME / 1024u));
+    print_kb(", used ", (total - free) * (PMM_FRAME / 1024u));
+    print_kb(", free ", free * (PMM_FRAME / 1024u));
+    print_kb("\n[ARENA] used ", (uint32_t)(arena_used(&arena) / 1024u));
+    print_kb(", free ", (uint32_t)(arena_free(&arena) / 1024u));
+    char buf[12];
+    itoa((int)arena.allocs, buf);
+    serial_print(", ");
+    serial_print(buf);
+    serial_print(" blocks\n");
 }
 
 void kernel_main(uint32_t magic, void* mbi) {
-    (void)magic; (void)mbi;
-    
+    // Memory map first: the Multiboot info sits in low memory that the
+    // SMP trampoline later reuses
+    int have_map = pmm_init_multiboot(magic, mbi, (uintptr_t)_kernel_start, (uintptr_t)_kernel_end) == 0;
+
+    // Interrupts first: serial output is queued and sent by the UART IRQ
+    idt_init();
+    uart_init(KERNEL_BAUD);
+    // LCD timing spins on the TSC; calibrate it against PIT channel 2 once
+    tsc_calibrate();
+
     serial_print("\n--- QUOREMIND KERNEL OS BOOTED (TEXT MODE) ---\n");
-    init_system(&state);
+    if (!have_map) serial_print("[PMM] No Multiboot memory map: static pools only\n");
+
+    // Boot arena: torus buffers and AP stacks
+    size_t arena_bytes = (size_t)KERNEL_ARENA_MB << 20;
+    size_t half_free = (size_t)(pmm_frames_free() / 2) * PMM_FRAME;
+    if (arena_bytes > half_free) arena_bytes = half_free;
+    if (arena_bytes && arena_init_frames(&arena, arena_bytes) == 0) {
+        qcore_field_set_allocator(field_from_arena, field_to_arena, &arena);
+    }
+    if (init_system_dim(&state, KERNEL_TORUS_DIM) != 0) {
+        serial_print("[PMM] Torus does not fit, falling back to the default grid\n");
+        qcore_field_set_allocator(0, 0, 0);
+        if (init_system(&state) != 0) {
+            serial_print("[PMM] No memory for the torus, halting\n");
+            return;
+        }
+    }
+#ifdef KERNEL_SSE
+    report_sse_speedup();
+#endif
+
+    // Application processors take bands of torus rows (qemu -smp 4)
+    int cpus = smp_init(&arena);
+    smp_attach(&state);
+    char cpu_buf[12];
+    itoa(cpus, cpu_buf);
+    serial_print("[SMP] ");
+    serial_print(cpu_buf);
+    serial_print(" CPU(s) online\n");
+    report_memory();
     k_clear(BLACK);
 
-    // Initialize I2C LCD
+    // Initialize I2C LCD (behind the PIIX4 SMBus controller)
+    uint16_t smb_base = i2c_init();
+    serial_print(smb_base ? "[I2C] PIIX4 SMBus found\n" : "[I2C] No SMBus controller, LCD writes dropped\n");
     lcd_init(&lcd, 0x27, 20, 4);
     lcd_clear(&lcd);
     lcd_set_cursor(&lcd, 0, 0);
     lcd_print(&lcd, "Q-CORE HEARTBEAT");
 
+    // Fixed-rate tick: the CPU halts between steps instead of spinning
+    uint32_t tick_hz = pit_init(KERNEL_TICK_HZ);
+    irq_enable();
+    char hz_buf[12];
+    itoa((int)tick_hz, hz_buf);
+    serial_print("[TICK] PIT at ");
+    serial_print(hz_buf);
+    serial_print(" Hz\n");
+
     int step = 0;
+    uint32_t vga_cells = 0;
+    uint32_t missed = 0;        // Ticks that passed while a step was still running
+    uint32_t next_tick = pit_ticks() + 1;
     while (1) {
+        pit_wait_until(next_tick);
+        uint32_t late = pit_ticks() - next_tick;
+        if (late > 0) missed += late; // Skip them: one step per tick, never a burst
+        next_tick += late + 1;
+
         solve_step(&state, 0.05f);
 
+        // Every frame is composed from scratch in the back buffer;
+        // k_flush() then touches only the cells that changed
+        k_clear(BLACK);
+
         // Header & Banner
         render_banner(&state);
         k_print_at(2, 6, "|===================================================|", DARK_GRAY, BLACK);
@@ -166,14 +308,20 @@ void kernel_main(uint32_t magic, void* mbi) {
         // 2. Toroidal Modulation (Fan around the channel)
         int tx = 55;
         uint8_t tor_color = (state.sync_clock_c > 0.5f) ? CYAN : LIGHT_BLUE;
-        for (int i = 0; i < TORUS_DIM; i++) {
-            for (int j = 0; j < TORUS_DIM; j++) {
-                float intensity = state.phi_re[i][j]*state.phi_re[i][j] + state.phi_im[i][j]*state.phi_im[i][j];
+        int dim = state.torus_dim;
+        int t_step = (dim > 16) ? dim / 16 : 1; // At most 16x16 glyphs in text mode
+        float ring = (float)TORUS_DIM / (float)dim;
+        for (int i = 0; i < dim; i += t_step) {
+            for (int j = 0; j < dim; j += t_step) {
+                int k = TORUS_AT(&state, i, j);
+                float intensity = state.phi_re[k]*state.phi_re[k] + state.phi_im[k]*state.phi_im[k];
                 if (intensity > 0.3f) {
-                    float angle = (float)i * (2.0f * PI / TORUS_DIM) + state.global_identity;
-                    float radius = 5.0f + (float)j * 0.4f;
-                    int x_pos = tx + (int)(k_cos(angle) * radius * 2.1f);
-                    int y_pos = center_y + (int)(k_sin(angle) * radius);
+                    float angle = (float)i * (2.0f * PI / dim) + state.global_identity;
+                    float radius = 5.0f + (float)j * 0.4f * ring;
+                    float sa, ca;
+                    k_sincos(angle, &sa, &ca);
+                    int x_pos = tx + (int)(ca * radius * 2.1f);
+                    int y_pos = center_y + (int)(sa * radius);
                     
                     char t_out = (state.breathing_state > 0.5f) ? '*' : '.';
                     if (state.solenoid_filter < 0.68f) t_out = ' ';
@@ -192,7 +340,29 @@ void kernel_main(uint32_t magic, void* mbi) {
             for(int s=0; s<10; s++) k_putc(10+s, 19+i, (s < sync_len) ? '>' : '-', (sync_len > 9) ? GREEN : DARK_GRAY, BLACK);
         }
 
-        k_print_at(2, 22, "ENV: QEMU-I386 // BRIDGE: TORUS-SHEAR // CORE: MULTIPLEX", DARK_GRAY, BLACK);
+        k_print_at(2, 22, "ENV: QEMU-I386 // BRIDGE: TORUS-SHEAR // CPUS:", DARK_GRAY, BLACK);
+        k_print_at(49, 22, cpu_buf, (cpus > 1) ? GREEN : DARK_GRAY, BLACK);
+
+        // Cells the previous flush had to write to VGA memory
+        char vga_buf[8];
+        itoa((int)vga_cells, vga_buf);
+        k_print_at(2, 23, "VGA CELLS/FRAME:", DARK_GRAY, BLACK);
+        k_print_at(19, 23, vga_buf, DARK_GRAY, BLACK);
+        char tick_buf[12];
+        itoa((int)pit_ticks(), tick_buf);
+        k_print_at(30, 23, "TICK:", DARK_GRAY, BLACK);
+        k_print_at(36, 23, tick_buf, DARK_GRAY, BLACK);
+        k_print_at(47, 23, "@", DARK_GRAY, BLACK);
+        k_print_at(49, 23, hz_buf, DARK_GRAY, BLACK);
+        k_print_at(53, 23, "HZ  MISSED:", DARK_GRAY, BLACK);
+        char missed_buf[12];
+        itoa((int)missed, missed_buf);
+        k_print_at(65, 23, missed_buf, missed ? YELLOW : DARK_GRAY, BLACK);
+        char drop_buf[12];
+        itoa((int)uart_dropped(), drop_buf);
+        k_print_at(2, 24, "SERIAL DROPPED:", DARK_GRAY, BLACK);
+        k_print_at(18, 24, drop_buf, uart_dropped() ? YELLOW : DARK_GRAY, BLACK);
+        vga_cells = k_flush();
 
         if (step % 5 == 0) {
             static const char spinner[] = {'|', '/', '-', '\\'};
@@ -204,6 +374,19 @@ void kernel_main(uint32_t magic, void* mbi) {
             serial_print("  BRTH: ");
             if (state.breathing_state > 0.5f) serial_print("ON ");
             else serial_print("OFF");
+            serial_print("  MISSED: ");
+            serial_print(missed_buf);
+            serial_print("  LCD TX: ");
+            char lcd_buf[12];
+            itoa((int)lcd.chars_sent, lcd_buf);
+            serial_print(lcd_buf);
+            serial_print("  I2C: ");
+            itoa((int)i2c_transactions(), lcd_buf);
+            serial_print(lcd_buf);
+            serial_print("/");
+            itoa((int)i2c_bytes(), lcd_buf);
+            serial_print(lcd_buf);
+            serial_print("B");
 
             // Update LCD with Stability & RMS
             lcd_set_cursor(&lcd, 0, 1);
@@ -230,8 +413,5 @@ void kernel_main(uint32_t magic, void* mbi) {
             lcd_print(&lcd, power_buf);
         }
         step++;
-
-        // Delay loop for visibility (approx 60fps in QEMU environment)
-        for (volatile int i = 0; i < 4000000; i++); 
     }
 }
@@ -0,0 +1,42 @@
+#include "pit.h"
+#include "idt.h"
+#include "io.h"
+
+#define PIT_CH0 0x40
+#define PIT_CMD 0x43
+
+static volatile uint32_t ticks;
+
+static void pit_irq(void) {
+    ticks++;
+}
+
+uint32_t pit_init(uint32_t hz) {
+    if (hz < PIT_MIN_HZ) hz = PIT_MIN_HZ;
+    if (hz > PIT_BASE_HZ) hz = PIT_BASE_HZ;
+    uint32_t divisor = (PIT_BASE_HZ + hz / 2) / hz;
+    if (divisor > 0xFFFF) divisor = 0xFFFF;
+
+    outb(PIT_CMD, 0x34);    // Channel 0, lobyte/hibyte, mode 2 (rate generator)
+    outb(PIT_CH0, (uint8_t)(divisor & 0xFF));
+    outb(PIT_CH0, (uint8_t)(divisor >> 8));
+    irq_install(0, pit_irq);
+    return PIT_BASE_HZ / divisor;
+}
+
+uint32_t pit_ticks(void) {
+    return ticks;
+}
+
+void pit_wait_until(uint32_t target) {
+    for (;;) {
+        // Check with interrupts off: "sti; hlt" cannot lose a tick that
+        // lands between the check and the hlt (sti takes effect after hlt)
+        irq_disable();
+        if ((int32_t)(ticks - target) >= 0) {
+            irq_enable();
+            return;
+        }
+        __asm__ volatile ( "sti; hlt" );
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef PIT_H
+#define PIT_H
+
+#include <stdint.h>
+
+/*
+ * 8253/8254 PIT channel 0 as the kernel's periodic tick (IRQ 0).
+ * Needs idt_init() first; the tick counter advances once interrupts
+ * are enabled.
+ */
+
+#define PIT_BASE_HZ 1193182u
+#define PIT_MIN_HZ 19u          // Largest 16-bit divisor
+
+/**
+ * @brief Program channel 0 as a rate generator and install its IRQ.
+ * @param hz Requested rate, clamped to [PIT_MIN_HZ, PIT_BASE_HZ].
+ * @return The rate actually programmed (divisor rounding).
+ */
+uint32_t pit_init(uint32_t hz);
+
+/**
+ * @brief Ticks since pit_init(); wraps at 2^32 (compare by difference).
+ */
+uint32_t pit_ticks(void);
+
+/**
+ * @brief Sleep (hlt) until pit_ticks() reaches target; returns at once if
+ *        it already has. Interrupts must be enabled.
+ */
+void pit_wait_until(uint32_t target);
+
+#endif // PIT_H
@@ -0,0 +1,134 @@
+#include "pmm.h"
+
+#define LOW_MEMORY 0x100000u
+#define MB_FLAG_MEM 0x001u          // mem_lower / mem_upper valid
+#define MB_FLAG_MMAP 0x040u         // mmap_length / mmap_addr valid
+#define MB_INFO_BYTES 88u
+#define MB_MMAP_AVAILABLE 1u
+
+static uint32_t bitmap[PMM_FRAMES / 32];
+static uint32_t frames_total;
+static uint32_t frames_free;
+static uint32_t search_from;        // No free frame below this one
+
+static int frame_used(uint32_t f) {
+    return (bitmap[f / 32] >> (f % 32)) & 1u;
+}
+
+static void set_used(uint32_t f) {
+    bitmap[f / 32] |= 1u << (f % 32);
+}
+
+static void set_free(uint32_t f) {
+    bitmap[f / 32] &= ~(1u << (f % 32));
+}
+
+void pmm_reset(void) {
+    for (uint32_t i = 0; i < PMM_FRAMES / 32; i++) bitmap[i] = 0xFFFFFFFFu;
+    frames_total = 0;
+    frames_free = 0;
+    search_from = PMM_FRAMES;
+}
+
+void pmm_add_region(uint64_t base, uint64_t len) {
+    uint64_t first = (base + PMM_FRAME - 1) / PMM_FRAME;
+    uint64_t last = (base + len) / PMM_FRAME;               // Exclusive
+    if (last > PMM_FRAMES) last = PMM_FRAMES;
+    for (uint64_t f = first; f < last; f++) {
+        if (!frame_used((uint32_t)f)) continue;
+        set_free((uint32_t)f);
+        frames_total++;
+        frames_free++;
+    }
+    if (first < last && first < search_from) search_from = (uint32_t)first;
+}
+
+void pmm_reserve(uint64_t base, uint64_t len) {
+    uint64_t first = base / PMM_FRAME;
+    uint64_t last = (base + len + PMM_FRAME - 1) / PMM_FRAME;
+    if (last > PMM_FRAMES) last = PMM_FRAMES;
+    for (uint64_t f = first; f < last; f++) {
+        if (frame_used((uint32_t)f)) continue;
+        set_used((uint32_t)f);
+        frames_free--;
+    }
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t rd64(const uint8_t *p) {
+    return (uint64_t)rd32(p) | ((uint64_t)rd32(p + 4) << 32);
+}
+
+int pmm_init_multiboot(uint32_t magic, const void *mbi, uintptr_t kernel_start, uintptr_t kernel_end) {
+    pmm_reset();
+    if (magic != MULTIBOOT_BOOTLOADER_MAGIC || !mbi) return -1;
+
+    const uint8_t *info = (const uint8_t *)mbi;
+    uint32_t flags = rd32(info);
+    uint32_t map_len = 0;
+    uintptr_t map_addr = 0;
+    if (flags & MB_FLAG_MMAP) {
+        // Entries: size (excluding itself), base_addr, length, type
+        map_len = rd32(info + 44);
+        map_addr = rd32(info + 48);
+        const uint8_t *e = (const uint8_t *)map_addr;
+        const uint8_t *end = e + map_len;
+        while (e + 24 <= end) {
+            if (rd32(e + 20) == MB_MMAP_AVAILABLE) pmm_add_region(rd64(e + 4), rd64(e + 12));
+            e += rd32(e) + 4;
+        }
+    } else if (flags & MB_FLAG_MEM) {
+        pmm_add_region(LOW_MEMORY, (uint64_t)rd32(info + 8) * 1024u);
+    } else {
+        return -1;
+    }
+
+    pmm_reserve(0, LOW_MEMORY);
+    pmm_reserve(kernel_start, kernel_end - kernel_start);
+    pmm_reserve((uintptr_t)mbi, MB_INFO_BYTES);
+    if (map_len) pmm_reserve(map_addr, map_len);
+    return 0;
+}
+
+uintptr_t pmm_alloc_frames(uint32_t count) {
+    if (count == 0 || count > frames_free) return 0;
+
+    uint32_t run = 0;
+    for (uint32_t f = search_from; f < PMM_FRAMES; f++) {
+        if (frame_used(f)) {
+            run = 0;
+            continue;
+        }
+        if (++run < count) continue;
+
+        uint32_t first = f + 1 - count;
+        for (uint32_t g = first; g <= f; g++) set_used(g);
+        frames_free -= count;
+        if (first == search_from) {
+            while (search_from < PMM_FRAMES && frame_used(search_from)) search_from++;
+        }
+        return (uintptr_t)first * PMM_FRAME;
+    }
+    return 0;
+}
+
+void pmm_free_frames(uintptr_t addr, uint32_t count) {
+    uint32_t first = (uint32_t)(addr / PMM_FRAME);
+    for (uint32_t f = first; f < first + count && f < PMM_FRAMES; f++) {
+        if (!frame_used(f)) continue;
+        set_free(f);
+        frames_free++;
+    }
+    if (first < search_from) search_from = first;
+}
+
+uint32_t pmm_frames_total(void) {
+    return frames_total;
+}
+
+uint32_t pmm_frames_free(void) {
+    return frames_free;
+}
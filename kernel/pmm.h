@@ -0,0 +1,42 @@
+#ifndef PMM_H
+#define PMM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Physical frame allocator: one bit per 4 KiB frame over the first
+ * PMM_MAX_PHYS bytes (set = used). Everything starts reserved; usable
+ * ranges from the Multiboot memory map are then freed, and the low 1 MiB
+ * (BIOS, SMP trampoline, Multiboot info), the kernel image and the map
+ * itself reserved again. Memory is identity-mapped (no paging), so a
+ * frame's physical address is also its pointer.
+ */
+
+#define PMM_FRAME 4096u
+#define PMM_MAX_PHYS (1024u * 1024u * 1024u)    // 32-bit, no PAE: the first 1 GiB
+#define PMM_FRAMES (PMM_MAX_PHYS / PMM_FRAME)
+#define MULTIBOOT_BOOTLOADER_MAGIC 0x2BADB002u
+
+void pmm_reset(void);                               // Every frame reserved
+void pmm_add_region(uint64_t base, uint64_t len);   // Free the frames wholly inside
+void pmm_reserve(uint64_t base, uint64_t len);      // Reserve every frame touched
+
+/**
+ * @brief Build the frame map from a Multiboot 1 info block.
+ *        Uses the mmap entries, or mem_upper when the loader gave no map.
+ * @return 0 on success, -1 on a bad magic or no memory information.
+ */
+int pmm_init_multiboot(uint32_t magic, const void *mbi, uintptr_t kernel_start, uintptr_t kernel_end);
+
+/**
+ * @brief Allocate count contiguous frames (first fit).
+ * @return Physical address of the first frame, or 0 if no run is long enough.
+ */
+uintptr_t pmm_alloc_frames(uint32_t count);
+void pmm_free_frames(uintptr_t addr, uint32_t count);
+
+uint32_t pmm_frames_total(void);    // Usable frames found in the map
+uint32_t pmm_frames_free(void);
+
+#endif // PMM_H
@@ -0,0 +1,316 @@
+#include <math.h>
+#include "qcore_adaptive.h"
+
+#define ADAPT_STAGES 7
+#define ADAPT_SAFETY 0.9f
+#define ADAPT_GROW_MAX 5.0f
+#define ADAPT_SHRINK_MAX 0.2f
+
+// Dormand-Prince 5(4): nodes, stage weights (row 7 is the 5th-order
+// solution, so k7 is f at the new point) and 5th minus 4th-order weights
+static const float dp_c[ADAPT_STAGES] = {0.0f, 1.0f / 5.0f, 3.0f / 10.0f, 4.0f / 5.0f, 8.0f / 9.0f, 1.0f, 1.0f};
+static const float dp_a[ADAPT_STAGES][ADAPT_STAGES - 1] = {
+    {0},
+    {1.0f / 5.0f},
+    {3.0f / 40.0f, 9.0f / 40.0f},
+    {44.0f / 45.0f, -56.0f / 15.0f, 32.0f / 9.0f},
+    {19372.0f / 6561.0f, -25360.0f / 2187.0f, 64448.0f / 6561.0f, -212.0f / 729.0f},
+    {9017.0f / 3168.0f, -355.0f / 33.0f, 46732.0f / 5247.0f, 49.0f / 176.0f, -5103.0f / 18656.0f},
+    {35.0f / 384.0f, 0.0f, 500.0f / 1113.0f, 125.0f / 192.0f, -2187.0f / 6784.0f, 11.0f / 84.0f},
+};
+static const float dp_e[ADAPT_STAGES] = {71.0f / 57600.0f, 0.0f, -71.0f / 16695.0f, 71.0f / 1920.0f,
+                                         -17253.0f / 339200.0f, 22.0f / 525.0f, -1.0f / 40.0f};
+
+// Scalar part of the ODE state
+enum { Y_RHO, Y_TEMP, Y_IDENT, Y_COUNT };
+
+/**
+ * @brief Inputs held constant over one frame
+ */
+typedef struct {
+    float target;           // ρ*: canal target stability
+    float pump;             // Intensity drive toward |Φ| = 1
+    float heating;          // Joule (held launder voltage) + acoustic load
+    float healing;          // Coherent sound: dρ/dt bonus
+    float shock;            // Loud noise: dρ/dt penalty
+    float inv_cells;
+} AdaptiveDrive;
+
+static size_t plane_bytes(int torus_dim) {
+    size_t cells = (size_t)torus_dim * (size_t)torus_dim;
+    return (cells * sizeof(float) + QCORE_FIELD_ALIGN - 1) & ~(size_t)(QCORE_FIELD_ALIGN - 1);
+}
+
+int qcore_adaptive_init(QcoreAdaptive *ctl, int torus_dim, float rtol, float atol,
+                        float dt_min, float dt_max) {
+    if (torus_dim < 1 || torus_dim > TORUS_DIM_MAX) return -1;
+    if (!(rtol >= 0.0f) || !(atol >= 0.0f) || rtol + atol <= 0.0f) return -1;
+    if (!(dt_min > 0.0f) || !(dt_max >= dt_min)) return -1;
+
+    size_t plane = plane_bytes(torus_dim);
+    if (!qcore_field_alloc(&ctl->scratch, 2 * (ADAPT_STAGES + 1) * plane)) return -1;
+    unsigned char *base = (unsigned char *)ctl->scratch.base;
+    for (int s = 0; s < ADAPT_STAGES; s++) {
+        ctl->k_re[s] = (float *)(base + (2 * s) * plane);
+        ctl->k_im[s] = (float *)(base + (2 * s + 1) * plane);
+    }
+    ctl->y_re = (float *)(base + 2 * ADAPT_STAGES * plane);
+    ctl->y_im = (float *)(base + (2 * ADAPT_STAGES + 1) * plane);
+
+    ctl->torus_dim = torus_dim;
+    ctl->rtol = rtol;
+    ctl->atol = atol;
+    ctl->dt_min = dt_min;
+    ctl->dt_max = dt_max;
+    qcore_adaptive_reset(ctl);
+    return 0;
+}
+
+void qcore_adaptive_release(QcoreAdaptive *ctl) {
+    qcore_field_free(&ctl->scratch);
+    ctl->torus_dim = 0;
+}
+
+void qcore_adaptive_reset(QcoreAdaptive *ctl) {
+    ctl->h = 0.0f;          // First frame starts from its own dt
+    ctl->err_last = 0.0f;
+    ctl->accepted = 0;
+    ctl->rejected = 0;
+    ctl->floored = 0;
+    ctl->rhs_evals = 0;
+}
+
+/**
+ * @brief dρ/dt, dT/dt, dI/dt at time t; also returns c, the sync clock
+ */
+static float scalar_rhs(const AdaptiveDrive *d, float t, const float *y, float mean_intensity, float *dy) {
+    float On = golden_operator(t);
+    float c = mean_intensity * On * On;
+    float gate = k_phase_lock(t);
+    gate *= gate;
+
+    float d_rho = ((d->target - y[Y_RHO]) * 0.2f + c * 10.0f) * gate + d->healing - d->shock;
+    if (y[Y_TEMP] > 60.0f) d_rho -= (y[Y_TEMP] - 60.0f) * 0.01f;
+
+    dy[Y_RHO] = d_rho;
+    dy[Y_TEMP] = d->heating - (y[Y_TEMP] - 22.0f) * 0.05f;
+    dy[Y_IDENT] = (c > 0.5f) ? c * 0.1f : 0.0f;
+    return c;
+}
+
+static float error_ratio(float err, float y0, float y1, const QcoreAdaptive *ctl) {
+    float mag = fabsf(y0) > fabsf(y1) ? fabsf(y0) : fabsf(y1);
+    return err / (ctl->atol + ctl->rtol * mag);
+}
+
+/**
+ * @brief Stage 0 of a substep: k1 = f(t, y) on the current state.
+ * @return c at (t, y).
+ */
+static float first_stage(QcoreAdaptive *ctl, const SystemState *state, const AdaptiveDrive *d,
+                         float t, const float *y, float *ks) {
+    int cells = state->torus_dim * state->torus_dim;
+    float w = 2.0f * golden_operator(t);
+    float decay = (100.0f - y[Y_RHO]) * 0.002f;
+    float *kr = ctl->k_re[0], *ki = ctl->k_im[0];
+    float sum = 0.0f;
+    for (int k = 0; k < cells; k++) {
+        float r = state->phi_re[k], im = state->phi_im[k];
+        float intensity = r * r + im * im;
+        float g = (1.0f - intensity) * d->pump - decay;
+        kr[k] = -w * im + g * r;
+        ki[k] = w * r + g * im;
+        sum += intensity;
+    }
+    ctl->rhs_evals++;
+    return scalar_rhs(d, t, y, sum * d->inv_cells, ks);
+}
+
+/**
+ * @brief Stages 1..6 of one trial substep of size h from (t, y).
+ *        Leaves the candidate field in y_re/y_im, its scalars in y_new and
+ *        k7 = f(t + h, y_new) in stage slot 6.
+ * @return Scaled error (<= 1: within tolerance); *c_new is c at the candidate.
+ */
+static float trial_step(QcoreAdaptive *ctl, const SystemState *state, const AdaptiveDrive *d,
+                        float t, float h, const float *y, float ks[ADAPT_STAGES][Y_COUNT],
+                        float *y_new, float *c_new) {
+    int cells = state->torus_dim * state->torus_dim;
+    float field_err = 0.0f;
+
+    for (int s = 1; s < ADAPT_STAGES; s++) {
+        float ha[ADAPT_STAGES - 1];
+        for (int j = 0; j < s; j++) ha[j] = h * dp_a[s][j];
+
+        float ys[Y_COUNT];
+        for (int v = 0; v < Y_COUNT; v++) {
+            ys[v] = y[v];
+            for (int j = 0; j < s; j++) ys[v] += ha[j] * ks[j][v];
+        }
+
+        float ts = t + dp_c[s] * h;
+        float w = 2.0f * golden_operator(ts);
+        float decay = (100.0f - ys[Y_RHO]) * 0.002f;
+        // Stage field in passes the compiler can vectorize: y = y0 + Σ ha_j k_j,
+        // then f(y) with the intensity sum
+        float *restrict yr = ctl->y_re, *restrict yi = ctl->y_im;
+        const float *y0_re = state->phi_re, *y0_im = state->phi_im;
+        for (int k = 0; k < cells; k++) {
+            yr[k] = y0_re[k];
+            yi[k] = y0_im[k];
+        }
+        for (int j = 0; j < s; j++) {
+            const float *restrict kr_j = ctl->k_re[j], *restrict ki_j = ctl->k_im[j];
+            float a = ha[j];
+            for (int k = 0; k < cells; k++) {
+                yr[k] += a * kr_j[k];
+                yi[k] += a * ki_j[k];
+            }
+        }
+
+        float *restrict kr = ctl->k_re[s], *restrict ki = ctl->k_im[s];
+        float sum = 0.0f;
+        for (int k = 0; k < cells; k++) {
+            float r = yr[k], im = yi[k];
+            float intensity = r * r + im * im;
+            float g = (1.0f - intensity) * d->pump - decay;
+            kr[k] = -w * im + g * r;
+            ki[k] = w * r + g * im;
+            sum += intensity;
+        }
+
+        if (s == ADAPT_STAGES - 1) {
+            // Stage 7 is the 5th-order candidate: embedded error per component
+            const float *kr_j[ADAPT_STAGES], *ki_j[ADAPT_STAGES];
+            for (int j = 0; j < ADAPT_STAGES; j++) {
+                kr_j[j] = ctl->k_re[j];
+                ki_j[j] = ctl->k_im[j];
+            }
+            for (int k = 0; k < cells; k++) {
+                float er = 0.0f, ei = 0.0f;
+                for (int j = 0; j < ADAPT_STAGES; j++) {
+                    er += dp_e[j] * kr_j[j][k];
+                    ei += dp_e[j] * ki_j[j][k];
+                }
+                float qr = error_ratio(h * er, y0_re[k], yr[k], ctl);
+                float qi = error_ratio(h * ei, y0_im[k], yi[k], ctl);
+                field_err += qr * qr + qi * qi;
+            }
+        }
+        ctl->rhs_evals++;
+        float c = scalar_rhs(d, ts, ys, sum * d->inv_cells, ks[s]);
+        if (s == ADAPT_STAGES - 1) {
+            for (int v = 0; v < Y_COUNT; v++) y_new[v] = ys[v];
+            *c_new = c;
+        }
+    }
+
+    // Error over ρ, T and the RMS of the field; I is integrated, not controlled
+    float err = sqrtf(field_err / (2.0f * (float)cells));
+    for (int v = Y_RHO; v <= Y_TEMP; v++) {
+        float e = 0.0f;
+        for (int j = 0; j < ADAPT_STAGES; j++) e += dp_e[j] * ks[j][v];
+        float q = fabsf(error_ratio(h * e, y[v], y_new[v], ctl));
+        if (q > err) err = q;
+    }
+    return err;
+}
+
+static float next_h(const QcoreAdaptive *ctl, float h, float err, int rejected) {
+    float fac = (err > 0.0f) ? ADAPT_SAFETY * powf(err, -0.2f) : ADAPT_GROW_MAX;
+    if (fac > ADAPT_GROW_MAX) fac = ADAPT_GROW_MAX;
+    if (fac < ADAPT_SHRINK_MAX) fac = ADAPT_SHRINK_MAX;
+    if (rejected && fac > 1.0f) fac = 1.0f;
+    float h_new = h * fac;
+    if (h_new > ctl->dt_max) h_new = ctl->dt_max;
+    if (h_new < ctl->dt_min) h_new = ctl->dt_min;
+    return h_new;
+}
+
+int solve_step_adaptive(SystemState *state, float dt, QcoreAdaptive *ctl) {
+    if (ctl->torus_dim != state->torus_dim) return -1;
+
+    float t = state->time;
+    float t_end = t + dt;
+    int cells = state->torus_dim * state->torus_dim;
+
+    // Sampled once per frame, as in solve_step: the launder sees the
+    // frame's end time and its voltage heats the whole frame
+    float v_pulse = hal_launder_step(&state->launder, t_end);
+    state->solenoid_filter = 1.0f / (1.0f + (v_pulse * 0.1f));
+    state->causal_flux *= state->solenoid_filter;
+    state->power_draw = (v_pulse * v_pulse) / 10.0f;
+
+    AdaptiveDrive d;
+    d.target = (state->shear_flow >= 9.9f) ? 100.0f : (state->shear_flow * 8.0f);
+    d.pump = (state->shear_flow / 10.0f) * 0.1f;
+    d.heating = state->power_draw + state->audio_energy * 20.0f;
+    d.healing = state->audio_coherence * 5.0f;
+    d.shock = (state->audio_energy > 0.5f) ? state->audio_energy * 10.0f : 0.0f;
+    d.inv_cells = 1.0f / (float)cells;
+
+    float y[Y_COUNT] = {state->stability, state->temperature, state->global_identity};
+    float ks[ADAPT_STAGES][Y_COUNT];
+    float c = first_stage(ctl, state, &d, t, y, ks[0]);
+
+    float h = (ctl->h > 0.0f) ? ctl->h : dt;
+    if (h > ctl->dt_max) h = ctl->dt_max;
+    if (h < ctl->dt_min) h = ctl->dt_min;
+
+    int accepted = 0;
+    while (t < t_end) {
+        // Cut the substep to land on the frame end (absorbing a float sliver)
+        float remaining = t_end - t;
+        int final = (h >= remaining || remaining - h < 1e-3f * h);
+        float step = final ? remaining : h;
+
+        float y_new[Y_COUNT], c_new;
+        float err = trial_step(ctl, state, &d, t, step, y, ks, y_new, &c_new);
+        ctl->err_last = err;
+        if (err > 1.0f && step > ctl->dt_min) {
+            ctl->rejected++;
+            h = next_h(ctl, step, err, 1);
+            continue;
+        }
+        if (err > 1.0f) ctl->floored++;
+        ctl->accepted++;
+        accepted++;
+
+        // Accept: candidate becomes the state, k7 becomes the next k1 (FSAL)
+        for (int k = 0; k < cells; k++) {
+            state->phi_re[k] = ctl->y_re[k];
+            state->phi_im[k] = ctl->y_im[k];
+        }
+        float *swap = ctl->k_re[0]; ctl->k_re[0] = ctl->k_re[ADAPT_STAGES - 1]; ctl->k_re[ADAPT_STAGES - 1] = swap;
+        swap = ctl->k_im[0]; ctl->k_im[0] = ctl->k_im[ADAPT_STAGES - 1]; ctl->k_im[ADAPT_STAGES - 1] = swap;
+        for (int v = 0; v < Y_COUNT; v++) {
+            y[v] = y_new[v];
+            ks[0][v] = ks[ADAPT_STAGES - 1][v];
+        }
+        c = c_new;
+        t = final ? t_end : t + step;
+
+        // Same clamp as solve_step, per substep; a clamped ρ invalidates k1
+        if (y[Y_RHO] < 0.0f || y[Y_RHO] > 100.0f) {
+            y[Y_RHO] = (y[Y_RHO] < 0.0f) ? 0.0f : 100.0f;
+            if (t < t_end) c = first_stage(ctl, state, &d, t, y, ks[0]);
+        }
+
+        // A cut final substep says nothing about the step the error allows
+        float h_next = next_h(ctl, step, err, 0);
+        if (step >= h || h_next > h) h = h_next;
+    }
+    ctl->h = h;
+
+    state->time = t_end;
+    state->sync_clock_c = c;
+    state->stability = y[Y_RHO];
+    state->temperature = y[Y_TEMP];
+    state->global_identity = y[Y_IDENT];
+
+    float cooling = (state->temperature - 22.0f) * 0.05f;
+    state->entropy_rate = d.heating + cooling;
+
+    solve_step_observe(state, dt);
+    return accepted;
+}
@@ -0,0 +1,70 @@
+#ifndef QCORE_ADAPTIVE_H
+#define QCORE_ADAPTIVE_H
+
+#include <stdint.h>
+#include "qcore_metriplectic.h"
+
+/*
+ * Adaptive-step alternative to solve_step (Dormand-Prince 5(4)).
+ *
+ * solve_step_adaptive(state, dt, ctl) has the same contract as
+ * solve_step(state, dt): it advances state->time by exactly dt and
+ * samples the launder, the filters and the diagnostics once. In between,
+ * the continuous part of the model runs as one ODE,
+ *
+ *   dΦ/dt = i·2·On(t)·Φ + Φ·((1 - |Φ|²)·pump - decay(ρ))
+ *   dρ/dt = ((ρ* - ρ)·0.2 + 10·c)·k_phase_lock(t)² + thermal/acoustic terms
+ *   dT/dt = P + 20·E - 0.05·(T - 22)
+ *   dI/dt = 0.1·c when c > 0.5
+ *
+ * with c = On(t)²·<|Φ|²> and the launder voltage held over the frame.
+ * Substeps are sized so that the embedded error of ρ, T and Φ (RMS over
+ * the cells) stays within atol + rtol·|y|, clamped to [dt_min, dt_max].
+ * A substep that fails at dt_min is accepted anyway and counted in
+ * `floored`. The last substep of a frame is cut to land on t + dt; the
+ * controller's proposal carries over to the next frame.
+ *
+ * The torus update is serial: an attached executor is not used.
+ */
+
+typedef struct {
+    float rtol;             // Relative tolerance
+    float atol;             // Absolute tolerance
+    float dt_min;           // Smallest substep
+    float dt_max;           // Largest substep
+    float h;                // Next trial substep
+    float err_last;         // Scaled error of the last substep (<= 1: accepted)
+    uint64_t accepted;      // Substeps kept
+    uint64_t rejected;      // Substeps retried with a smaller h
+    uint64_t floored;       // Accepted at dt_min with error > 1
+    uint64_t rhs_evals;     // Right-hand side evaluations
+    int torus_dim;
+    float *k_re[7];         // Stage derivatives (k7 of one substep is k1 of the next)
+    float *k_im[7];
+    float *y_re;            // Stage / candidate field
+    float *y_im;
+    FieldBlock scratch;     // Backing storage of the stage buffers
+} QcoreAdaptive;
+
+/**
+ * @brief Set tolerances and step bounds and allocate the stage buffers
+ *        for an N x N torus (9 pairs of planes).
+ * @return 0, or -1 on bad arguments or allocation failure.
+ */
+int qcore_adaptive_init(QcoreAdaptive *ctl, int torus_dim, float rtol, float atol,
+                        float dt_min, float dt_max);
+void qcore_adaptive_release(QcoreAdaptive *ctl);
+
+/**
+ * @brief Zero the counters and restart the step-size controller.
+ */
+void qcore_adaptive_reset(QcoreAdaptive *ctl);
+
+/**
+ * @brief Advance state by dt with adaptive Dormand-Prince substeps.
+ * @return Substeps accepted during this call, or -1 if ctl was set up
+ *         for another grid size.
+ */
+int solve_step_adaptive(SystemState *state, float dt, QcoreAdaptive *ctl);
+
+#endif // QCORE_ADAPTIVE_H
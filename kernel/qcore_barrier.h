@@ -0,0 +1,41 @@
+#ifndef QCORE_BARRIER_H
+#define QCORE_BARRIER_H
+
+/*
+ * Sense-reversing spin barrier for a fixed set of participants.
+ *
+ * Header-only on GCC __atomic builtins, so the same code runs between
+ * pthreads on the host and between bare-metal cores in the kernel (no
+ * futex, no libatomic). The last arrival resets the count and flips the
+ * shared sense; everyone else spins until the sense matches their own.
+ * Each participant keeps its own local sense, starting at 0.
+ */
+
+typedef struct {
+    int count;              // Arrivals still missing this round
+    int sense;              // Flipped by the last arrival
+    int total;
+} QcoreBarrier;
+
+static inline void qcore_barrier_init(QcoreBarrier *b, int total) {
+    b->count = total;
+    b->sense = 0;
+    b->total = total;
+}
+
+static inline void qcore_barrier_wait(QcoreBarrier *b, int *local_sense) {
+    int sense = !*local_sense;
+    *local_sense = sense;
+    if (__atomic_sub_fetch(&b->count, 1, __ATOMIC_ACQ_REL) == 0) {
+        __atomic_store_n(&b->count, b->total, __ATOMIC_RELAXED);
+        __atomic_store_n(&b->sense, sense, __ATOMIC_RELEASE);
+    } else {
+        while (__atomic_load_n(&b->sense, __ATOMIC_ACQUIRE) != sense) {
+#if defined(__i386__) || defined(__x86_64__)
+            __builtin_ia32_pause();
+#endif
+        }
+    }
+}
+
+#endif // QCORE_BARRIER_H
@@ -0,0 +1,399 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "qcore_metriplectic.h"
+#include "qcore_torus_simd.h"
+#include "hal_audio_dsp.h"
+#include "qcore_pool.h"
+#include "qcore_adaptive.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+/*
+ * Headless microbenchmarks for the physics core.
+ *
+ * Every (bench, grid size, step count) cell runs `warmup` untimed
+ * repetitions, then `reps` timed ones of `steps` operations each. One op
+ * is one call of the benchmarked function (one step for solve_step, one
+ * 1024-sample block for audio_rms and audio_spectrum). The median
+ * repetition is reported; cycles are TSC reference cycles.
+ *
+ * solve_step_strang is solve_step with the Strang-split breathing projector.
+ * solve_step_core is solve_step with every diagnostic group off (vortex_z,
+ * Protocol Alpha, LaSalle, CoreBus): the core dynamics alone.
+ * solve_step_osc is solve_step with the phase bank attached (state.osc),
+ * re-anchored every BENCH_OSC_RESYNC steps.
+ * solve_step_adaptive runs the Dormand-Prince path at BENCH_DT with the
+ * ADAPTIVE_* tolerances; one op is one frame, however many substeps it took.
+ *
+ * audio_rms is the per-period level pass alone (RMS, peak, crossings);
+ * audio_spectrum is the full hal_audio_analyze, Goertzel bank included.
+ * Samples/s is AUDIO_BLOCK · ops/s.
+ *
+ * --threads 1,2,4 adds solve_step_parallel, the opt-in pooled torus
+ * update, once per thread count (threads = 0 marks the serial benches).
+ *
+ * usage: qcore_bench [--dims 8,32,256] [--steps 100,1000] [--threads 1,2,4]
+ *                    [--warmup N] [--reps N] [--json FILE] [--csv FILE]
+ *                    [--label STR]
+ */
+
+#define BENCH_MAX_LIST 16
+#define BENCH_MAX_REPS 64
+#define AUDIO_BLOCK 1024
+#define BENCH_DT 0.05f
+#define ADAPTIVE_RTOL 1e-3f
+#define ADAPTIVE_ATOL 1e-3f
+#define ADAPTIVE_DT_MIN 1e-4f
+#define ADAPTIVE_DT_MAX 0.5f
+#define BENCH_OSC_RESYNC 256
+
+typedef struct {
+    SystemState state;
+    SystemState proto;
+    QcoreAdaptive adaptive;
+    QcoreOscBank osc;
+    GoldenLaunder launder;
+    short audio[AUDIO_BLOCK];
+    AudioSpectrum spectrum;
+    float t;
+    volatile float sink;    // Keeps pure calls from being optimized away
+} BenchCtx;
+
+typedef struct {
+    const char *name;
+    int uses_grid;          // 1: swept over --dims, 0: grid independent
+    int uses_pool;          // 1: swept over --threads with a QcorePool attached
+    void (*run)(BenchCtx *ctx, int ops);
+} BenchDef;
+
+typedef struct {
+    const char *bench;
+    int torus_dim;
+    int steps;
+    int threads;
+    int reps;
+    double ns_per_op;       // Median repetition
+    double ns_per_op_min;
+    double ops_per_s;
+    double cycles_per_op;
+} BenchResult;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static unsigned long long read_tsc(void) {
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// --- Benchmarked operations ---
+
+static void run_solve_step(BenchCtx *ctx, int ops) {
+    for (int i = 0; i < ops; i++) solve_step(&ctx->state, BENCH_DT);
+}
+
+static void run_solve_step_strang(BenchCtx *ctx, int ops) {
+    ctx->state.integrator = INTEGRATOR_STRANG;
+    for (int i = 0; i < ops; i++) solve_step(&ctx->state, BENCH_DT);
+}
+
+static void run_solve_step_core(BenchCtx *ctx, int ops) {
+    for (int g = 0; g < DIAG_GROUPS; g++) set_system_diagnostics(&ctx->state, g, DIAG_OFF);
+    for (int i = 0; i < ops; i++) solve_step(&ctx->state, BENCH_DT);
+}
+
+static void run_solve_step_osc(BenchCtx *ctx, int ops) {
+    ctx->state.osc = &ctx->osc;
+    for (int i = 0; i < ops; i++) solve_step(&ctx->state, BENCH_DT);
+}
+
+static void run_solve_step_adaptive(BenchCtx *ctx, int ops) {
+    for (int i = 0; i < ops; i++) solve_step_adaptive(&ctx->state, BENCH_DT, &ctx->adaptive);
+}
+
+static void run_breathing_projector(BenchCtx *ctx, int ops) {
+    for (int i = 0; i < ops; i++) {
+        ctx->state.time += BENCH_DT;
+        apply_breathing_projector(&ctx->state, BENCH_DT);
+    }
+}
+
+static void run_sync_clock(BenchCtx *ctx, int ops) {
+    float acc = 0.0f;
+    for (int i = 0; i < ops; i++) acc += compute_sync_clock(&ctx->state);
+    ctx->sink = acc;
+}
+
+static void run_golden_operator(BenchCtx *ctx, int ops) {
+    float acc = 0.0f;
+    for (int i = 0; i < ops; i++) {
+        ctx->t += BENCH_DT;
+        acc += golden_operator(ctx->t);
+    }
+    ctx->sink = acc;
+}
+
+static void run_launder_step(BenchCtx *ctx, int ops) {
+    float acc = 0.0f;
+    for (int i = 0; i < ops; i++) {
+        ctx->t += BENCH_DT;
+        acc += hal_launder_step(&ctx->launder, ctx->t);
+    }
+    ctx->sink = acc;
+}
+
+static void run_audio_rms(BenchCtx *ctx, int ops) {
+    AudioAccum acc;
+    AudioSummary summary;
+    hal_audio_accum_reset(&acc);
+    for (int i = 0; i < ops; i++) {
+        hal_audio_accumulate(&acc, ctx->audio, AUDIO_BLOCK);
+        hal_audio_summarize(&acc, &summary);
+        hal_audio_apply(&ctx->state, &summary);
+    }
+}
+
+static void run_audio_spectrum(BenchCtx *ctx, int ops) {
+    for (int i = 0; i < ops; i++) hal_audio_analyze(&ctx->state, &ctx->spectrum, ctx->audio, AUDIO_BLOCK);
+}
+
+static const BenchDef benches[] = {
+    {"solve_step",                1, 0, run_solve_step},
+    {"solve_step_parallel",       1, 1, run_solve_step},
+    {"solve_step_strang",         1, 0, run_solve_step_strang},
+    {"solve_step_core",           1, 0, run_solve_step_core},
+    {"solve_step_osc",            1, 0, run_solve_step_osc},
+    {"solve_step_adaptive",       1, 0, run_solve_step_adaptive},
+    {"apply_breathing_projector", 1, 0, run_breathing_projector},
+    {"compute_sync_clock",        1, 0, run_sync_clock},
+    {"golden_operator",           0, 0, run_golden_operator},
+    {"hal_launder_step",          0, 0, run_launder_step},
+    {"audio_rms",                 0, 0, run_audio_rms},
+    {"audio_spectrum",            0, 0, run_audio_spectrum},
+};
+#define N_BENCHES ((int)(sizeof(benches) / sizeof(benches[0])))
+
+// --- Harness ---
+
+// Deterministic 440 Hz tone plus LCG noise at 44.1 kHz
+static void fill_audio(short *buf, int n) {
+    unsigned int seed = 12345u;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        float noise = (float)((seed >> 16) & 0x7fff) / 32768.0f - 0.5f;
+        float v = 0.3f * k_sin(2.0f * PI * 440.0f * (float)i / 44100.0f) + 0.05f * noise;
+        buf[i] = (short)(v * 32767.0f);
+    }
+}
+
+static void reset_ctx(BenchCtx *ctx) {
+    copy_system(&ctx->state, &ctx->proto);
+    hal_launder_init(&ctx->launder);
+    qcore_adaptive_reset(&ctx->adaptive);
+    hal_audio_spectrum_reset(&ctx->spectrum);
+    ctx->t = 0.0f;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static BenchResult measure(const BenchDef *b, BenchCtx *ctx, int dim, int steps,
+                           int warmup, int reps) {
+    double ns[BENCH_MAX_REPS];
+    double cyc[BENCH_MAX_REPS];
+
+    for (int w = 0; w < warmup; w++) {
+        reset_ctx(ctx);
+        b->run(ctx, steps);
+    }
+    for (int r = 0; r < reps; r++) {
+        reset_ctx(ctx);
+        unsigned long long c0 = read_tsc();
+        double t0 = now_ns();
+        b->run(ctx, steps);
+        double t1 = now_ns();
+        unsigned long long c1 = read_tsc();
+        ns[r] = (t1 - t0) / steps;
+        cyc[r] = (double)(c1 - c0) / steps;
+    }
+
+    // Median by time; cycles from the same repetition
+    double sorted[BENCH_MAX_REPS];
+    memcpy(sorted, ns, (size_t)reps * sizeof(double));
+    qsort(sorted, (size_t)reps, sizeof(double), cmp_double);
+    double median = sorted[reps / 2];
+    int mid = 0;
+    for (int r = 0; r < reps; r++) if (ns[r] == median) mid = r;
+
+    BenchResult res;
+    res.bench = b->name;
+    res.torus_dim = dim;
+    res.steps = steps;
+    res.threads = 0;
+    res.reps = reps;
+    res.ns_per_op = median;
+    res.ns_per_op_min = sorted[0];
+    res.ops_per_s = (median > 0.0) ? 1e9 / median : 0.0;
+    res.cycles_per_op = cyc[mid];
+    return res;
+}
+
+static int parse_list(const char *s, int *out) {
+    int n = 0;
+    while (*s && n < BENCH_MAX_LIST) {
+        char *end;
+        long v = strtol(s, &end, 10);
+        if (end == s || v <= 0) return -1;
+        out[n++] = (int)v;
+        s = (*end == ',') ? end + 1 : end;
+        if (*end && *end != ',') return -1;
+    }
+    return n;
+}
+
+static void write_json(FILE *f, const char *label, int warmup, const BenchResult *r, int n) {
+    fprintf(f, "{\n");
+    fprintf(f, "  \"label\": \"");
+    for (const char *c = label; *c; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', f);
+        if ((unsigned char)*c >= 0x20) fputc(*c, f);
+    }
+    fprintf(f, "\",\n");
+    fprintf(f, "  \"torus_isa\": \"%s\",\n", torus_isa_name(torus_isa_active()));
+    fprintf(f, "  \"warmup\": %d,\n", warmup);
+    fprintf(f, "  \"results\": [\n");
+    for (int i = 0; i < n; i++) {
+        fprintf(f, "    {\"bench\": \"%s\", \"torus_dim\": %d, \"steps\": %d, \"threads\": %d, "
+                   "\"reps\": %d, \"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, \"ops_per_s\": %.1f, "
+                   "\"cycles_per_op\": %.1f}%s\n",
+                r[i].bench, r[i].torus_dim, r[i].steps, r[i].threads, r[i].reps, r[i].ns_per_op,
+                r[i].ns_per_op_min, r[i].ops_per_s, r[i].cycles_per_op, (i + 1 < n) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+static void write_csv(FILE *f, const BenchResult *r, int n) {
+    fprintf(f, "bench,torus_dim,steps,threads,reps,ns_per_op,ns_per_op_min,ops_per_s,cycles_per_op\n");
+    for (int i = 0; i < n; i++) {
+        fprintf(f, "%s,%d,%d,%d,%d,%.3f,%.3f,%.1f,%.1f\n", r[i].bench, r[i].torus_dim, r[i].steps,
+                r[i].threads, r[i].reps, r[i].ns_per_op, r[i].ns_per_op_min, r[i].ops_per_s, r[i].cycles_per_op);
+    }
+}
+
+static int usage(const char *argv0) {
+    fprintf(stderr, "usage: %s [--dims 8,32,256] [--steps 100,1000] [--threads 1,2,4]\n"
+                    "          [--warmup N] [--reps N] [--json FILE] [--csv FILE] [--label STR]\n",
+            argv0);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    int dims[BENCH_MAX_LIST] = {8, 32, 256};
+    int steps[BENCH_MAX_LIST] = {100, 1000};
+    int threads[BENCH_MAX_LIST];
+    int n_dims = 3, n_steps = 2, n_threads = 0;
+    int warmup = 1, reps = 5;
+    const char *json_path = NULL, *csv_path = NULL, *label = "";
+
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!val) return usage(argv[0]);
+        if (strcmp(opt, "--dims") == 0) n_dims = parse_list(val, dims);
+        else if (strcmp(opt, "--steps") == 0) n_steps = parse_list(val, steps);
+        else if (strcmp(opt, "--threads") == 0) n_threads = parse_list(val, threads);
+        else if (strcmp(opt, "--warmup") == 0) warmup = atoi(val);
+        else if (strcmp(opt, "--reps") == 0) reps = atoi(val);
+        else if (strcmp(opt, "--json") == 0) json_path = val;
+        else if (strcmp(opt, "--csv") == 0) csv_path = val;
+        else if (strcmp(opt, "--label") == 0) label = val;
+        else return usage(argv[0]);
+        i++;
+    }
+    if (n_dims <= 0 || n_steps <= 0 || n_threads < 0 || warmup < 0 || reps < 1 || reps > BENCH_MAX_REPS) {
+        return usage(argv[0]);
+    }
+    for (int d = 0; d < n_dims; d++) {
+        if (dims[d] > TORUS_DIM_MAX) return usage(argv[0]);
+    }
+
+    int max_results = N_BENCHES * (n_dims + 1) * n_steps * (n_threads + 1);
+    BenchResult *results = malloc((size_t)max_results * sizeof(BenchResult));
+    BenchCtx *ctx = calloc(1, sizeof(BenchCtx));
+    if (!results || !ctx || init_system_osc(&ctx->osc, BENCH_OSC_RESYNC) != 0 ||
+        hal_audio_spectrum_init(&ctx->spectrum, 44100.0f) != 0) return 1;
+    fill_audio(ctx->audio, AUDIO_BLOCK);
+
+    printf("[BENCH] torus ISA %s, warmup %d, reps %d\n",
+           torus_isa_name(torus_isa_active()), warmup, reps);
+    printf("%-26s %6s %7s %7s %12s %14s %14s\n", "bench", "dim", "steps", "threads",
+           "ns/op", "ops/s", "cycles/op");
+
+    int n = 0;
+    for (int b = 0; b < N_BENCHES; b++) {
+        // Grid-independent benches run once per step count on the default grid
+        int nd = benches[b].uses_grid ? n_dims : 1;
+        int nt = benches[b].uses_pool ? n_threads : 1;
+        for (int d = 0; d < nd; d++) {
+            int dim = benches[b].uses_grid ? dims[d] : TORUS_DIM;
+            for (int t = 0; t < nt; t++) {
+                if (init_system_dim(&ctx->proto, dim) != 0 || init_system_dim(&ctx->state, dim) != 0 ||
+                    qcore_adaptive_init(&ctx->adaptive, dim, ADAPTIVE_RTOL, ADAPTIVE_ATOL,
+                                        ADAPTIVE_DT_MIN, ADAPTIVE_DT_MAX) != 0) {
+                    fprintf(stderr, "Cannot allocate a %dx%d torus\n", dim, dim);
+                    return 1;
+                }
+                QcorePool *pool = NULL;
+                if (benches[b].uses_pool) {
+                    pool = qcore_pool_create(threads[t]);
+                    if (!pool) return 1;
+                    qcore_pool_attach(pool, &ctx->state);
+                }
+                for (int s = 0; s < n_steps; s++) {
+                    BenchResult r = measure(&benches[b], ctx, dim, steps[s], warmup, reps);
+                    if (!benches[b].uses_grid) r.torus_dim = 0;
+                    if (pool) r.threads = qcore_pool_threads(pool);
+                    results[n++] = r;
+                    printf("%-26s %6d %7d %7d %12.2f %14.4g %14.1f\n", r.bench, r.torus_dim,
+                           r.steps, r.threads, r.ns_per_op, r.ops_per_s, r.cycles_per_op);
+                    fflush(stdout);
+                }
+                qcore_pool_destroy(pool);
+                qcore_adaptive_release(&ctx->adaptive);
+                release_system(&ctx->state);
+                release_system(&ctx->proto);
+            }
+        }
+    }
+
+    if (json_path) {
+        FILE *f = fopen(json_path, "w");
+        if (!f) { perror(json_path); return 1; }
+        write_json(f, label, warmup, results, n);
+        fclose(f);
+    }
+    if (csv_path) {
+        FILE *f = fopen(csv_path, "w");
+        if (!f) { perror(csv_path); return 1; }
+        write_csv(f, results, n);
+        fclose(f);
+    }
+
+    qcore_osc_release(&ctx->osc);
+    free(results);
+    free(ctx);
+    return 0;
+}
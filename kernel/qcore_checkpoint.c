@@ -0,0 +1,225 @@
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "qcore_checkpoint.h"
+
+#define CKPT_PATH_MAX 4096
+
+/*
+ * Scalar record, version 2. Fields are packed back to back in this
+ * order, so the record does not depend on struct padding. Appending or
+ * reordering entries changes the format: bump QCORE_CKPT_VERSION.
+ */
+#define CKPT_FIELD(member) { offsetof(SystemState, member), sizeof(((SystemState *)0)->member) }
+
+static const struct {
+    size_t offset;
+    size_t size;
+} ckpt_fields[] = {
+    CKPT_FIELD(time),
+    CKPT_FIELD(kink_amplitude),
+    CKPT_FIELD(stability),
+    CKPT_FIELD(shear_flow),
+    CKPT_FIELD(sync_clock_c),
+    CKPT_FIELD(global_identity),
+    CKPT_FIELD(gamma_strobe),
+    CKPT_FIELD(breathing_state),
+    CKPT_FIELD(node_density),
+    CKPT_FIELD(bit_stream),
+    CKPT_FIELD(causal_flux),
+    CKPT_FIELD(golden_filter),
+    CKPT_FIELD(launder.target_phi),
+    CKPT_FIELD(launder.current_rms),
+    CKPT_FIELD(launder.duty_cycle),
+    CKPT_FIELD(launder.kp),
+    CKPT_FIELD(launder.step_count),
+    CKPT_FIELD(launder.last_v),
+    CKPT_FIELD(launder.rms_acc),
+    CKPT_FIELD(solenoid_filter),
+    CKPT_FIELD(temperature),
+    CKPT_FIELD(entropy_rate),
+    CKPT_FIELD(power_draw),
+    CKPT_FIELD(rayleigh_raw),
+    CKPT_FIELD(l2_error),
+    CKPT_FIELD(thermal_eff),
+    CKPT_FIELD(lyapunov_v),
+    CKPT_FIELD(lyapunov_dot),
+    CKPT_FIELD(is_lasalle_locked),
+    CKPT_FIELD(audio_energy),
+    CKPT_FIELD(audio_coherence),
+    CKPT_FIELD(vortex_z),
+    CKPT_FIELD(bus.core_sync),
+    CKPT_FIELD(bus.bus_throughput),
+    CKPT_FIELD(bus.packet_loss),
+    CKPT_FIELD(observe.period),
+    CKPT_FIELD(observe.pending),
+    CKPT_FIELD(observe.elapsed),
+};
+
+#define CKPT_N_FIELDS (sizeof(ckpt_fields) / sizeof(ckpt_fields[0]))
+#define CKPT_SCALAR_MAX 256
+
+static size_t scalar_record_bytes(void) {
+    size_t n = 0;
+    for (size_t i = 0; i < CKPT_N_FIELDS; i++) n += ckpt_fields[i].size;
+    return n;
+}
+
+static void pack_scalars(const SystemState *state, unsigned char *rec) {
+    const unsigned char *src = (const unsigned char *)state;
+    for (size_t i = 0; i < CKPT_N_FIELDS; i++) {
+        memcpy(rec, src + ckpt_fields[i].offset, ckpt_fields[i].size);
+        rec += ckpt_fields[i].size;
+    }
+}
+
+static void unpack_scalars(SystemState *state, const unsigned char *rec) {
+    unsigned char *dst = (unsigned char *)state;
+    for (size_t i = 0; i < CKPT_N_FIELDS; i++) {
+        memcpy(dst + ckpt_fields[i].offset, rec, ckpt_fields[i].size);
+        rec += ckpt_fields[i].size;
+    }
+}
+
+// CRC-32 (IEEE, reflected), bitwise: the record is only a few hundred bytes
+static uint32_t crc32(const unsigned char *p, size_t n) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < n; i++) {
+        crc ^= p[i];
+        for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+static int write_all(int fd, const void *buf, size_t n) {
+    const unsigned char *p = (const unsigned char *)buf;
+    while (n > 0) {
+        ssize_t w = write(fd, p, n);
+        if (w < 0) return -1;
+        p += w;
+        n -= (size_t)w;
+    }
+    return 0;
+}
+
+static int read_all(int fd, void *buf, size_t n, off_t offset) {
+    unsigned char *p = (unsigned char *)buf;
+    while (n > 0) {
+        ssize_t r = pread(fd, p, n, offset);
+        if (r <= 0) return -1;
+        p += r;
+        n -= (size_t)r;
+        offset += r;
+    }
+    return 0;
+}
+
+// Make the rename itself durable
+static void sync_parent_dir(const char *path) {
+    char dir[CKPT_PATH_MAX];
+    const char *slash = strrchr(path, '/');
+    if (!slash) {
+        strcpy(dir, ".");
+    } else {
+        size_t len = (slash == path) ? 1 : (size_t)(slash - path);
+        memcpy(dir, path, len);
+        dir[len] = '\0';
+    }
+    int fd = open(dir, O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd);
+    close(fd);
+}
+
+int qcore_checkpoint_save(const SystemState *state, const char *path) {
+    char tmp[CKPT_PATH_MAX];
+    if (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp)) return -1;
+
+    unsigned char rec[CKPT_SCALAR_MAX];
+    size_t rec_bytes = scalar_record_bytes();
+    pack_scalars(state, rec);
+
+    CheckpointHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, QCORE_CKPT_MAGIC, sizeof(h.magic));
+    h.version = QCORE_CKPT_VERSION;
+    h.endian = QCORE_CKPT_ENDIAN;
+    h.header_bytes = sizeof(CheckpointHeader);
+    h.scalar_bytes = (uint32_t)rec_bytes;
+    h.scalar_crc = crc32(rec, rec_bytes);
+    h.torus_dim = (uint32_t)state->torus_dim;
+    h.field_offset = (sizeof(h) + rec_bytes + QCORE_CKPT_ALIGN - 1) & ~(uint64_t)(QCORE_CKPT_ALIGN - 1);
+    h.field_bytes = system_field_bytes(state->torus_dim);
+
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return -1;
+
+    static const unsigned char zeros[QCORE_CKPT_ALIGN];
+    size_t pad = (size_t)h.field_offset - sizeof(h) - rec_bytes;
+    int rc = write_all(fd, &h, sizeof(h));
+    if (rc == 0) rc = write_all(fd, rec, rec_bytes);
+    if (rc == 0) rc = write_all(fd, zeros, pad);
+    if (rc == 0) rc = write_all(fd, state->phi_re, (size_t)h.field_bytes);
+    if (rc == 0) rc = fsync(fd);
+    if (close(fd) != 0) rc = -1;
+    if (rc == 0) rc = rename(tmp, path);
+    if (rc != 0) {
+        unlink(tmp);
+        return -1;
+    }
+    sync_parent_dir(path);
+    return 0;
+}
+
+int qcore_checkpoint_restore(SystemState *state, const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    CheckpointHeader h;
+    unsigned char rec[CKPT_SCALAR_MAX];
+    size_t rec_bytes = scalar_record_bytes();
+    struct stat st;
+    int ok = fstat(fd, &st) == 0 &&
+             read_all(fd, &h, sizeof(h), 0) == 0 &&
+             memcmp(h.magic, QCORE_CKPT_MAGIC, sizeof(h.magic)) == 0 &&
+             h.version == QCORE_CKPT_VERSION &&
+             h.endian == QCORE_CKPT_ENDIAN &&
+             h.header_bytes == sizeof(CheckpointHeader) &&
+             h.scalar_bytes == rec_bytes &&
+             h.torus_dim >= 1 && h.torus_dim <= TORUS_DIM_MAX &&
+             h.field_bytes == system_field_bytes((int)h.torus_dim) &&
+             h.field_offset % QCORE_CKPT_ALIGN == 0 &&
+             h.field_offset >= sizeof(h) + rec_bytes &&
+             (uint64_t)st.st_size >= h.field_offset + h.field_bytes &&
+             read_all(fd, rec, rec_bytes, sizeof(h)) == 0 &&
+             crc32(rec, rec_bytes) == h.scalar_crc;
+    if (!ok) {
+        close(fd);
+        return -1;
+    }
+
+    // Copy-on-write view of the file; plain read if the page size does not fit
+    FieldBlock field;
+    if (!qcore_field_map_file(&field, fd, (size_t)h.field_offset, (size_t)h.field_bytes)) {
+        if (!qcore_field_alloc(&field, (size_t)h.field_bytes) ||
+            read_all(fd, field.base, (size_t)h.field_bytes, (off_t)h.field_offset) != 0) {
+            qcore_field_free(&field);
+            close(fd);
+            return -1;
+        }
+    }
+    close(fd);
+
+    attach_system_field(state, (int)h.torus_dim, &field);
+    unpack_scalars(state, rec);
+    return 0;
+}
+
+int qcore_checkpoint_tick(const SystemState *state, const char *path, uint64_t interval) {
+    if (interval == 0 || state->launder.step_count == 0) return 0;
+    if (state->launder.step_count % interval != 0) return 0;
+    return (qcore_checkpoint_save(state, path) == 0) ? 1 : -1;
+}
@@ -0,0 +1,67 @@
+#ifndef QCORE_CHECKPOINT_H
+#define QCORE_CHECKPOINT_H
+
+#include <stdint.h>
+#include "qcore_metriplectic.h"
+
+/*
+ * Binary checkpoints of a SystemState (host only).
+ *
+ * Layout (native endianness, rejected on a mismatch):
+ *   CheckpointHeader
+ *   scalar record      every scalar of SystemState, GoldenLaunder and
+ *                      CoreBus, and the diagnostic schedule with its
+ *                      progress, packed in a fixed order (version 2)
+ *   zero padding       up to field_offset (page aligned)
+ *   field block        phi_re plane, phi_im plane, row scratch, exactly
+ *                      as init_system_dim() lays them out in memory
+ *
+ * Restoring maps the field block copy-on-write, so resuming a large grid
+ * costs one mmap; pages are read as the first step touches them.
+ */
+
+#define QCORE_CKPT_MAGIC "QCORECKP"
+#define QCORE_CKPT_VERSION 2u
+#define QCORE_CKPT_ENDIAN 0x01020304u
+#define QCORE_CKPT_ALIGN 4096u
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian;
+    uint32_t header_bytes;  // sizeof(CheckpointHeader)
+    uint32_t scalar_bytes;  // Size of the packed scalar record
+    uint32_t scalar_crc;    // CRC-32 of the scalar record
+    uint32_t torus_dim;
+    uint64_t field_offset;  // Multiple of QCORE_CKPT_ALIGN
+    uint64_t field_bytes;   // system_field_bytes(torus_dim)
+} CheckpointHeader;
+
+/**
+ * @brief Write state to path atomically: the data goes to "<path>.tmp",
+ *        is fsync'd, then renamed over path (and the directory fsync'd).
+ *        A crash leaves either the previous checkpoint or the new one.
+ * @return 0 on success, -1 on failure (path is left untouched).
+ */
+int qcore_checkpoint_save(const SystemState *state, const char *path);
+
+/**
+ * @brief Load a checkpoint into state, like init_system_dim() would
+ *        initialise it (release_system() a live state first). The field
+ *        is a private mapping of the file, falling back to a read when it
+ *        cannot be mapped. Run settings the checkpoint does not hold come
+ *        back at their init_system_dim() defaults: Euler integrator, no
+ *        phase bank, executor detached. The diagnostic schedule is
+ *        restored mid-period, as saved.
+ * @return 0 on success, -1 on I/O errors or a foreign/corrupt/other-version file.
+ */
+int qcore_checkpoint_restore(SystemState *state, const char *path);
+
+/**
+ * @brief Save every `interval` steps (counted by launder.step_count, one
+ *        per solve_step); call once after each step.
+ * @return 1 if a checkpoint was written, 0 if none was due, -1 on failure.
+ */
+int qcore_checkpoint_tick(const SystemState *state, const char *path, uint64_t interval);
+
+#endif // QCORE_CHECKPOINT_H
@@ -0,0 +1,403 @@
+#include <stdlib.h>
+#include <string.h>
+#include "qcore_ensemble.h"
+#include "qcore_torus_simd.h"
+
+enum {
+    SCRATCH_COS, SCRATCH_SIN, SCRATCH_ENERGY,
+    SCRATCH_LANES, SCRATCH_SUM = SCRATCH_LANES + TORUS_LANES_MAX,   // Reduction lanes, then tail / row sum
+    SCRATCH_DECAY, SCRATCH_PUMP, SCRATCH_GATE, SCRATCH_PWM, SCRATCH_VORTEX,
+    SCRATCH_CORE0, SCRATCH_CORE1, SCRATCH_CORE2, SCRATCH_CORE3,
+    ENSEMBLE_SCRATCH_SLOTS
+};
+
+#define ENSEMBLE_SCRATCH(ens, slot) ((ens)->scratch + (size_t)(slot) * (ens)->stride)
+
+/**
+ * @brief Time-only operators shared by every member sitting at the same t
+ */
+typedef struct {
+    float t;
+    float cos_dt, sin_dt;   // Breathing projector rotation
+    float energy_on;        // On^2 for the sync clock
+    float gate;             // Stability gate (phase lock squared)
+    float pwm_phase;        // Launder PWM carrier
+    float vortex_z;         // Nodal synthesis
+    float core_op[4];       // CoreBus phase-shifted operators
+} TimeTerms;
+
+static void eval_time_terms(TimeTerms *tt, float t, float dt) {
+    tt->t = t;
+
+    float On = golden_operator(t);
+    float dtheta = On * dt * 2.0f;
+    k_sincos(dtheta, &tt->sin_dt, &tt->cos_dt);
+    tt->energy_on = On * On;
+
+    float phase_coherence = k_phase_lock(t);
+    tt->gate = phase_coherence * phase_coherence;
+
+    float phase_mod = On * PI;
+    tt->pwm_phase = k_cos(t * PI * 2.0f + phase_mod);
+
+    tt->vortex_z = nodal_synthesis(t);
+
+    for (int i = 0; i < 4; i++) {
+        float core_phase = t + (float)i * (PI / 2.0f);
+        tt->core_op[i] = k_cos(PI * core_phase) * k_cos(PI * PHI * core_phase);
+    }
+}
+
+int ensemble_init(EnsembleState *ens, int count, int torus_dim) {
+    memset(ens, 0, sizeof(*ens));
+    if (count <= 0 || torus_dim < 1 || torus_dim > TORUS_DIM_MAX) return -1;
+    int cells = torus_dim * torus_dim;
+
+    int stride = (count + ENSEMBLE_LANES - 1) / ENSEMBLE_LANES * ENSEMBLE_LANES;
+    size_t lane_f = (size_t)stride * sizeof(float);
+
+    int n_float = 0;
+#define ENSEMBLE_COUNT(name) n_float++;
+    ENSEMBLE_FLOAT_FIELDS(ENSEMBLE_COUNT)
+#undef ENSEMBLE_COUNT
+    n_float += ENSEMBLE_SCRATCH_SLOTS;      // per-step scratch lanes
+    n_float += 2 * cells;                   // phi_re + phi_im
+
+    size_t bytes = (size_t)n_float * lane_f
+                 + (size_t)stride * sizeof(int)
+                 + (size_t)stride * sizeof(uint64_t);
+    bytes = (bytes + 63) & ~(size_t)63;
+
+    uint8_t *p = aligned_alloc(64, bytes);
+    if (!p) return -1;
+    memset(p, 0, bytes);
+
+    ens->block = p;
+    ens->count = count;
+    ens->stride = stride;
+    ens->torus_dim = torus_dim;
+
+    // Float lanes first: every slice is a multiple of 64 bytes, so all stay aligned
+#define ENSEMBLE_CARVE(name) ens->name = (float *)p; p += lane_f;
+    ENSEMBLE_FLOAT_FIELDS(ENSEMBLE_CARVE)
+#undef ENSEMBLE_CARVE
+    ens->scratch = (float *)p;        p += lane_f * ENSEMBLE_SCRATCH_SLOTS;
+    ens->phi_re = (float *)p;         p += lane_f * cells;
+    ens->phi_im = (float *)p;         p += lane_f * cells;
+    ens->launder_step_count = (uint64_t *)p; p += (size_t)stride * sizeof(uint64_t);
+    ens->is_lasalle_locked = (int *)p;
+
+    // Every member (and every padding lane) starts from the canonical initial condition
+    SystemState proto;
+    if (init_system_dim(&proto, torus_dim) != 0) {
+        ensemble_free(ens);
+        return -1;
+    }
+    for (int m = 0; m < stride; m++) ensemble_load(ens, m, &proto);
+    release_system(&proto);
+
+    return 0;
+}
+
+void ensemble_free(EnsembleState *ens) {
+    free(ens->block);
+    memset(ens, 0, sizeof(*ens));
+}
+
+int ensemble_load(EnsembleState *ens, int m, const SystemState *s) {
+    if (s->torus_dim != ens->torus_dim) return -1;
+    // The batch kernel is the Euler step with direct trig only, and it
+    // updates every diagnostic group every step
+    if (s->integrator != INTEGRATOR_EULER || s->osc) return -1;
+    for (int g = 0; g < DIAG_GROUPS; g++) {
+        if (s->observe.period[g] != 1) return -1;
+    }
+
+    ens->time[m] = s->time;
+    ens->kink_amplitude[m] = s->kink_amplitude;
+    ens->stability[m] = s->stability;
+    ens->shear_flow[m] = s->shear_flow;
+    ens->sync_clock_c[m] = s->sync_clock_c;
+    ens->global_identity[m] = s->global_identity;
+    ens->gamma_strobe[m] = s->gamma_strobe;
+    ens->breathing_state[m] = s->breathing_state;
+    ens->node_density[m] = s->node_density;
+    ens->bit_stream[m] = s->bit_stream;
+    ens->causal_flux[m] = s->causal_flux;
+    ens->golden_filter[m] = s->golden_filter;
+    ens->solenoid_filter[m] = s->solenoid_filter;
+    ens->temperature[m] = s->temperature;
+    ens->entropy_rate[m] = s->entropy_rate;
+    ens->power_draw[m] = s->power_draw;
+    ens->rayleigh_raw[m] = s->rayleigh_raw;
+    ens->l2_error[m] = s->l2_error;
+    ens->thermal_eff[m] = s->thermal_eff;
+    ens->lyapunov_v[m] = s->lyapunov_v;
+    ens->lyapunov_dot[m] = s->lyapunov_dot;
+    ens->is_lasalle_locked[m] = s->is_lasalle_locked;
+    ens->audio_energy[m] = s->audio_energy;
+    ens->audio_coherence[m] = s->audio_coherence;
+    ens->vortex_z[m] = s->vortex_z;
+
+    ens->launder_target_phi[m] = s->launder.target_phi;
+    ens->launder_current_rms[m] = s->launder.current_rms;
+    ens->launder_duty_cycle[m] = s->launder.duty_cycle;
+    ens->launder_kp[m] = s->launder.kp;
+    ens->launder_step_count[m] = s->launder.step_count;
+    ens->launder_last_v[m] = s->launder.last_v;
+    ens->launder_rms_acc[m] = s->launder.rms_acc;
+
+    ens->core_sync0[m] = s->bus.core_sync[0];
+    ens->core_sync1[m] = s->bus.core_sync[1];
+    ens->core_sync2[m] = s->bus.core_sync[2];
+    ens->core_sync3[m] = s->bus.core_sync[3];
+    ens->bus_throughput[m] = s->bus.bus_throughput;
+    ens->packet_loss[m] = s->bus.packet_loss;
+
+    int cells = ens->torus_dim * ens->torus_dim;
+    for (int k = 0; k < cells; k++) {
+        size_t c = (size_t)k * ens->stride + m;
+        ens->phi_re[c] = s->phi_re[k];
+        ens->phi_im[c] = s->phi_im[k];
+    }
+    return 0;
+}
+
+int ensemble_store(const EnsembleState *ens, int m, SystemState *s) {
+    if (s->torus_dim != ens->torus_dim) return -1;
+
+    s->time = ens->time[m];
+    s->kink_amplitude = ens->kink_amplitude[m];
+    s->stability = ens->stability[m];
+    s->shear_flow = ens->shear_flow[m];
+    s->sync_clock_c = ens->sync_clock_c[m];
+    s->global_identity = ens->global_identity[m];
+    s->gamma_strobe = ens->gamma_strobe[m];
+    s->breathing_state = ens->breathing_state[m];
+    s->node_density = ens->node_density[m];
+    s->bit_stream = ens->bit_stream[m];
+    s->causal_flux = ens->causal_flux[m];
+    s->golden_filter = ens->golden_filter[m];
+    s->solenoid_filter = ens->solenoid_filter[m];
+    s->temperature = ens->temperature[m];
+    s->entropy_rate = ens->entropy_rate[m];
+    s->power_draw = ens->power_draw[m];
+    s->rayleigh_raw = ens->rayleigh_raw[m];
+    s->l2_error = ens->l2_error[m];
+    s->thermal_eff = ens->thermal_eff[m];
+    s->lyapunov_v = ens->lyapunov_v[m];
+    s->lyapunov_dot = ens->lyapunov_dot[m];
+    s->is_lasalle_locked = ens->is_lasalle_locked[m];
+    s->audio_energy = ens->audio_energy[m];
+    s->audio_coherence = ens->audio_coherence[m];
+    s->vortex_z = ens->vortex_z[m];
+
+    s->launder.target_phi = ens->launder_target_phi[m];
+    s->launder.current_rms = ens->launder_current_rms[m];
+    s->launder.duty_cycle = ens->launder_duty_cycle[m];
+    s->launder.kp = ens->launder_kp[m];
+    s->launder.step_count = ens->launder_step_count[m];
+    s->launder.last_v = ens->launder_last_v[m];
+    s->launder.rms_acc = ens->launder_rms_acc[m];
+
+    s->bus.core_sync[0] = ens->core_sync0[m];
+    s->bus.core_sync[1] = ens->core_sync1[m];
+    s->bus.core_sync[2] = ens->core_sync2[m];
+    s->bus.core_sync[3] = ens->core_sync3[m];
+    s->bus.bus_throughput = ens->bus_throughput[m];
+    s->bus.packet_loss = ens->packet_loss[m];
+
+    // Every group is current after a batch step
+    for (int g = 0; g < DIAG_GROUPS; g++) {
+        s->observe.period[g] = 1;
+        s->observe.pending[g] = 0;
+        s->observe.elapsed[g] = 0.0f;
+    }
+
+    int cells = ens->torus_dim * ens->torus_dim;
+    for (int k = 0; k < cells; k++) {
+        size_t c = (size_t)k * ens->stride + m;
+        s->phi_re[k] = ens->phi_re[c];
+        s->phi_im[k] = ens->phi_im[c];
+    }
+    return 0;
+}
+
+/*
+ * Every stage below mirrors solve_step() operation for operation, so each
+ * member reproduces the scalar path bit for bit. Branches are written as
+ * selects and member loops run in fixed ENSEMBLE_LANES blocks over the padded
+ * stride so they vectorize at -O2 (built with -fno-trapping-math so the
+ * selects if-convert); only the trig of the time-only operators
+ * and the per-member PWM threshold stay scalar, and the time-only terms are
+ * evaluated once per distinct time.
+ */
+void solve_step_batch(EnsembleState *ens, float dt) {
+    const int n = ens->count;
+    const int stride = ens->stride;
+    const int cells = ens->torus_dim * ens->torus_dim;
+
+    float *restrict time = ens->time;
+    float *restrict stability = ens->stability;
+    float *restrict shear = ens->shear_flow;
+    float *restrict cos_v = ENSEMBLE_SCRATCH(ens, SCRATCH_COS);
+    float *restrict sin_v = ENSEMBLE_SCRATCH(ens, SCRATCH_SIN);
+    float *restrict energy = ENSEMBLE_SCRATCH(ens, SCRATCH_ENERGY);
+    float *restrict lanes = ENSEMBLE_SCRATCH(ens, SCRATCH_LANES);
+    float *restrict sum = ENSEMBLE_SCRATCH(ens, SCRATCH_SUM);
+    float *restrict decay = ENSEMBLE_SCRATCH(ens, SCRATCH_DECAY);
+    float *restrict pump = ENSEMBLE_SCRATCH(ens, SCRATCH_PUMP);
+    float *restrict gate = ENSEMBLE_SCRATCH(ens, SCRATCH_GATE);
+    float *restrict pwm = ENSEMBLE_SCRATCH(ens, SCRATCH_PWM);
+    float *restrict vortex = ENSEMBLE_SCRATCH(ens, SCRATCH_VORTEX);
+    float *restrict core_op = ENSEMBLE_SCRATCH(ens, SCRATCH_CORE0);   // 4 consecutive slots
+
+    // 1. Time advance and time-only operators (one evaluation per distinct t)
+    TimeTerms tt;
+    int have_tt = 0;
+    for (int m = 0; m < n; m++) {
+        time[m] += dt;
+        if (!have_tt || tt.t != time[m]) {
+            eval_time_terms(&tt, time[m], dt);
+            have_tt = 1;
+        }
+        cos_v[m] = tt.cos_dt;
+        sin_v[m] = tt.sin_dt;
+        energy[m] = tt.energy_on;
+        gate[m] = tt.gate;
+        pwm[m] = tt.pwm_phase;
+        vortex[m] = tt.vortex_z;
+        for (int i = 0; i < 4; i++) core_op[(size_t)i * stride + m] = tt.core_op[i];
+    }
+
+    // 2a. Breathing projector coefficients (stability before this step's update)
+    for (int b = 0; b < stride; b += ENSEMBLE_LANES)
+#pragma GCC ivdep
+    for (int m = b; m < b + ENSEMBLE_LANES; m++) {
+        decay[m] = (100.0f - stability[m]) * 0.002f;
+        pump[m] = (shear[m] / 10.0f) * 0.1f;
+    }
+
+    // The sync clock reduction follows the lane order of the torus kernel
+    // solve_step dispatches to, so each member's sum rounds the same way
+    TorusIsa isa = torus_isa_active();
+    const int width = torus_isa_lanes(isa);
+    const int body = cells - cells % width;
+    memset(lanes, 0, (size_t)width * stride * sizeof(float));
+    memset(sum, 0, (size_t)stride * sizeof(float));
+
+    // 2b. Fused toroidal update + sync clock reduction, one cell vector at a time
+    for (int c = 0; c < cells; c++) {
+        float *restrict re = ens->phi_re + (size_t)c * stride;
+        float *restrict im = ens->phi_im + (size_t)c * stride;
+        float *restrict acc = (c < body) ? lanes + (size_t)(c % width) * stride : sum;
+        for (int b = 0; b < stride; b += ENSEMBLE_LANES)
+#pragma GCC ivdep
+        for (int m = b; m < b + ENSEMBLE_LANES; m++) {
+            float r = re[m];
+            float i = im[m];
+            float nr = r * cos_v[m] - i * sin_v[m];
+            float ni = r * sin_v[m] + i * cos_v[m];
+
+            float intensity = nr*nr + ni*ni;
+            float drive = (1.0f - intensity) * pump[m];
+
+            nr += nr * (drive - decay[m]) * dt;
+            ni += ni * (drive - decay[m]) * dt;
+            re[m] = nr;
+            im[m] = ni;
+
+            float post = nr*nr + ni*ni;
+            acc[m] += post * energy[m];
+        }
+    }
+    torus_fold_lanes(isa, lanes, (size_t)stride, stride, sum);
+
+    // 2c-3. Sync clock, global identity, metriplectic coupling, launder duty correction
+    for (int b = 0; b < stride; b += ENSEMBLE_LANES)
+#pragma GCC ivdep
+    for (int m = b; m < b + ENSEMBLE_LANES; m++) {
+        float sync = sum[m] / (float)cells;
+        ens->sync_clock_c[m] = sync;
+        ens->global_identity[m] = (sync > 0.5f) ? ens->global_identity[m] + sync * dt * 0.1f
+                                                : ens->global_identity[m];
+
+        float target_stability = (shear[m] >= 9.9f) ? 100.0f : (shear[m] * 8.0f);
+        float tor_boost = (sync > 0.0f) ? sync * 10.0f : 0.0f;
+        float d_metr = ((target_stability - stability[m]) * 0.2f + tor_boost) * gate[m];
+        stability[m] += d_metr * dt;
+
+        float error = ens->launder_target_phi[m] - ens->launder_current_rms[m];
+        float duty = ens->launder_duty_cycle[m] + error * ens->launder_kp[m];
+        duty = (duty < 0.01f) ? 0.01f : duty;
+        duty = (duty > 0.50f) ? 0.50f : duty;
+        ens->launder_duty_cycle[m] = duty;
+        ens->launder_step_count[m]++;
+    }
+
+    // 5. Launder PWM: the threshold depends on each member's own duty cycle
+    for (int m = 0; m < n; m++) {
+        float threshold = k_cos(PI * ens->launder_duty_cycle[m]);
+        ens->launder_last_v[m] = (pwm[m] > threshold) ? 5.0f : 0.0f;
+        float instantaneous_v2 = ens->launder_last_v[m] * ens->launder_last_v[m];
+        ens->launder_rms_acc[m] = (0.9995f * ens->launder_rms_acc[m]) + (0.0005f * instantaneous_v2);
+        ens->launder_current_rms[m] = k_sqrt(ens->launder_rms_acc[m]);
+    }
+
+    // 5-9. Solenoid filter, thermal/acoustic, nodal, Protocol Alpha, LaSalle, bus
+    for (int b = 0; b < stride; b += ENSEMBLE_LANES)
+#pragma GCC ivdep
+    for (int m = b; m < b + ENSEMBLE_LANES; m++) {
+        float v_pulse = ens->launder_last_v[m];
+        float solenoid = 1.0f / (1.0f + (v_pulse * 0.1f));
+        ens->solenoid_filter[m] = solenoid;
+        ens->causal_flux[m] *= solenoid;
+
+        float power = (v_pulse * v_pulse) / 10.0f;
+        ens->power_draw[m] = power;
+        float heating = power;
+        float acoustic_load = ens->audio_energy[m] * 20.0f;
+        heating += acoustic_load;
+
+        float temp = ens->temperature[m];
+        float cooling = (temp - 22.0f) * 0.05f;
+        ens->entropy_rate[m] = heating + cooling;
+        temp += (heating - cooling) * dt;
+        ens->temperature[m] = temp;
+
+        float stab = stability[m];
+        stab = (temp > 60.0f) ? stab - (temp - 60.0f) * 0.01f * dt : stab;
+        float healing_boost = ens->audio_coherence[m] * 5.0f * dt;
+        stab += healing_boost;
+        stab = (ens->audio_energy[m] > 0.5f) ? stab - ens->audio_energy[m] * 10.0f * dt : stab;
+
+        ens->vortex_z[m] = vortex[m];
+
+        float ns_baseline = (shear[m] >= 9.9f) ? 0.0625f : (shear[m] / 10.0f) * 0.0625f;
+        float diff = ns_baseline - ens->sync_clock_c[m];
+        ens->l2_error[m] = (0.995f * ens->l2_error[m]) + (0.005f * (diff * diff));
+
+        float heat_penalty = (temp - 22.0f) * 0.1f;
+        ens->thermal_eff[m] = (stab * 1.5f) / (1.0f + heat_penalty + ens->entropy_rate[m]);
+
+        float rho_err = 100.0f - stab;
+        float phi_err = ens->launder_current_rms[m] - PHI;
+        float v_new = 0.5f * (rho_err * rho_err + phi_err * phi_err);
+        ens->lyapunov_dot[m] = (v_new - ens->lyapunov_v[m]) / dt;
+        ens->lyapunov_v[m] = v_new;
+        ens->is_lasalle_locked[m] = (stab > 98.0f) & ((phi_err * phi_err) < 0.001f);
+
+        float level = stab / 100.0f;
+        ens->core_sync0[m] = level * (core_op[m] * 0.5f + 0.5f);
+        ens->core_sync1[m] = level * (core_op[(size_t)stride + m] * 0.5f + 0.5f);
+        ens->core_sync2[m] = level * (core_op[(size_t)2 * stride + m] * 0.5f + 0.5f);
+        ens->core_sync3[m] = level * (core_op[(size_t)3 * stride + m] * 0.5f + 0.5f);
+
+        ens->bus_throughput[m] = ens->node_density[m] * ens->core_sync0[m];
+        ens->packet_loss[m] = (100.0f - stab) / 100.0f;
+
+        stab = (stab < 0) ? 0 : stab;
+        stab = (stab > 100) ? 100 : stab;
+        stability[m] = stab;
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef QCORE_ENSEMBLE_H
+#define QCORE_ENSEMBLE_H
+
+#include <stdint.h>
+#include "qcore_metriplectic.h"
+
+/**
+ * @brief Per-member float fields of the ensemble (SystemState scalars + HAL + bus)
+ */
+#define ENSEMBLE_FLOAT_FIELDS(X) \
+    X(time) X(kink_amplitude) X(stability) X(shear_flow) \
+    X(sync_clock_c) X(global_identity) X(gamma_strobe) X(breathing_state) \
+    X(node_density) X(bit_stream) X(causal_flux) X(golden_filter) \
+    X(solenoid_filter) X(temperature) X(entropy_rate) X(power_draw) \
+    X(rayleigh_raw) X(l2_error) X(thermal_eff) \
+    X(lyapunov_v) X(lyapunov_dot) \
+    X(audio_energy) X(audio_coherence) X(vortex_z) \
+    X(launder_target_phi) X(launder_current_rms) X(launder_duty_cycle) \
+    X(launder_kp) X(launder_last_v) X(launder_rms_acc) \
+    X(core_sync0) X(core_sync1) X(core_sync2) X(core_sync3) \
+    X(bus_throughput) X(packet_loss)
+
+/**
+ * @brief Structure-of-Arrays ensemble of N SystemStates
+ *
+ * Every scalar field is a contiguous array over members. The torus field is
+ * stored cell-major / member-minor: phi_re[cell * stride + m], so each grid
+ * cell of the whole ensemble is one contiguous vector.
+ */
+typedef struct {
+    int count;              // N: active members
+    int stride;             // Padded member count (multiple of ENSEMBLE_LANES)
+    int torus_dim;          // Shared grid resolution N of every member
+
+#define ENSEMBLE_DECLARE(name) float *name;
+    ENSEMBLE_FLOAT_FIELDS(ENSEMBLE_DECLARE)
+#undef ENSEMBLE_DECLARE
+
+    int *is_lasalle_locked;
+    uint64_t *launder_step_count;
+
+    float *phi_re;          // [N * N][stride]
+    float *phi_im;
+
+    float *scratch;         // Per-step scratch lanes (time-only terms, partial sums)
+
+    void *block;            // Single backing allocation
+} EnsembleState;
+
+#define ENSEMBLE_LANES 16
+
+// Lifecycle
+int ensemble_init(EnsembleState *ens, int count, int torus_dim);
+void ensemble_free(EnsembleState *ens);
+
+// AoS <-> SoA transfer (the state's torus_dim must match the ensemble's).
+// ensemble_load also refuses states the batch kernel cannot step like
+// solve_step would: the Strang integrator, an attached phase bank or a
+// diagnostic schedule other than every group every step. ensemble_store
+// writes that every-step schedule back.
+int ensemble_load(EnsembleState *ens, int m, const SystemState *state);
+int ensemble_store(const EnsembleState *ens, int m, SystemState *state);
+
+/**
+ * @brief Advance every member by dt. Member m evolves exactly as
+ *        solve_step() would evolve the SystemState loaded at slot m
+ *        (no executor attached) under the active torus ISA: the sync
+ *        clock is reduced in that ISA's lane order.
+ */
+void solve_step_batch(EnsembleState *ens, float dt);
+
+#endif // QCORE_ENSEMBLE_H
@@ -0,0 +1,49 @@
+#ifndef QCORE_FB_H
+#define QCORE_FB_H
+
+#include <stdint.h>
+
+/*
+ * Software framebuffer rasterizer (no window-system dependency).
+ *
+ * Pixels are 0x00RRGGBB, the 32-bit TrueColor layout X11 uses for
+ * depth-24 visuals, so a frame can be presented as one XImage. Every
+ * primitive clips to the buffer. Coordinates follow the Xlib calls they
+ * replace: rectangles and discs take their bounding box, text takes a
+ * baseline.
+ */
+
+#define QCORE_FB_GLYPH_W 8   // Built-in 8x8 font, printable ASCII
+#define QCORE_FB_GLYPH_H 8
+
+typedef struct {
+    uint32_t *pixels;
+    int width;
+    int height;
+    int stride;     // Pixels per row (>= width)
+} QcoreFramebuffer;
+
+void qcore_fb_clear(QcoreFramebuffer *fb, uint32_t color);
+
+/** @brief Solid w x h box (XFillRectangle). */
+void qcore_fb_fill_rect(QcoreFramebuffer *fb, int x, int y, int w, int h, uint32_t color);
+
+/** @brief One-pixel outline covering (w+1) x (h+1) pixels (XDrawRectangle). */
+void qcore_fb_draw_rect(QcoreFramebuffer *fb, int x, int y, int w, int h, uint32_t color);
+
+/** @brief Disc inscribed in the size x size box at (x, y) (full-circle XFillArc). */
+void qcore_fb_fill_disc(QcoreFramebuffer *fb, int x, int y, int size, uint32_t color);
+
+/**
+ * @brief One glyph with its baseline at y (XDrawString of one char).
+ *        Characters outside printable ASCII draw nothing.
+ */
+void qcore_fb_draw_char(QcoreFramebuffer *fb, int x, int y, char c, uint32_t color);
+
+/**
+ * @brief A string, QCORE_FB_GLYPH_W pixels per character.
+ * @return The advance in pixels.
+ */
+int qcore_fb_draw_text(QcoreFramebuffer *fb, int x, int y, const char *text, uint32_t color);
+
+#endif // QCORE_FB_H
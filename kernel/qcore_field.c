@@ -0,0 +1,147 @@
+#include "qcore_field.h"
+
+#if __STDC_HOSTED__
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+void *qcore_field_alloc(FieldBlock *blk, size_t bytes) {
+    blk->base = NULL;
+    blk->bytes = 0;
+    blk->kind = FIELD_BLOCK_NONE;
+    if (bytes == 0) return NULL;
+
+    if (bytes < QCORE_HUGE_PAGE) {
+        void *p = NULL;
+        if (posix_memalign(&p, QCORE_FIELD_ALIGN, bytes) != 0) return NULL;
+        memset(p, 0, bytes);
+        blk->base = p;
+        blk->bytes = bytes;
+        blk->kind = FIELD_BLOCK_HEAP;
+        return p;
+    }
+
+    // Large grids: whole huge pages. Anonymous mappings are already zeroed.
+    size_t len = (bytes + QCORE_HUGE_PAGE - 1) & ~(size_t)(QCORE_HUGE_PAGE - 1);
+    void *p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    if (p == MAP_FAILED) {
+        // No reserved hugetlbfs pages: ask for transparent huge pages instead
+        p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) return NULL;
+#ifdef MADV_HUGEPAGE
+        madvise(p, len, MADV_HUGEPAGE);
+#endif
+    }
+
+    blk->base = p;
+    blk->bytes = len;
+    blk->kind = FIELD_BLOCK_MMAP;
+    return p;
+}
+
+void *qcore_field_map_file(FieldBlock *blk, int fd, size_t offset, size_t bytes) {
+    blk->base = NULL;
+    blk->bytes = 0;
+    blk->kind = FIELD_BLOCK_NONE;
+    if (bytes == 0) return NULL;
+
+    void *p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, (off_t)offset);
+    if (p == MAP_FAILED) return NULL;
+
+    blk->base = p;
+    blk->bytes = bytes;
+    blk->kind = FIELD_BLOCK_MMAP;
+    return p;
+}
+
+void qcore_field_set_allocator(QcoreFieldAllocFn alloc, QcoreFieldFreeFn free_fn, void *ctx) {
+    // Host blocks always come from the heap or mmap
+    (void)alloc;
+    (void)free_fn;
+    (void)ctx;
+}
+
+void qcore_field_free(FieldBlock *blk) {
+    if (blk->kind == FIELD_BLOCK_HEAP) free(blk->base);
+    else if (blk->kind == FIELD_BLOCK_MMAP) munmap(blk->base, blk->bytes);
+    blk->base = NULL;
+    blk->bytes = 0;
+    blk->kind = FIELD_BLOCK_NONE;
+}
+
+#else
+
+/*
+ * Freestanding kernel: no heap. Field blocks come from the allocator the
+ * kernel registers once its arena is up, and before that (or without a
+ * memory map) from a static bump pool sized for a 64x64 torus (two planes
+ * plus row sums). Only the most recent pool block can be returned.
+ */
+#define QCORE_FIELD_POOL_BYTES ((2u * 64u * 64u + 64u) * sizeof(float) + QCORE_FIELD_ALIGN)
+
+static unsigned char field_pool[QCORE_FIELD_POOL_BYTES] __attribute__((aligned(QCORE_FIELD_ALIGN)));
+static size_t field_pool_top = 0;
+
+static QcoreFieldAllocFn ext_alloc;
+static QcoreFieldFreeFn ext_free;
+static void *ext_ctx;
+
+void qcore_field_set_allocator(QcoreFieldAllocFn alloc, QcoreFieldFreeFn free_fn, void *ctx) {
+    ext_alloc = alloc;
+    ext_free = free_fn;
+    ext_ctx = ctx;
+}
+
+void *qcore_field_alloc(FieldBlock *blk, size_t bytes) {
+    blk->base = NULL;
+    blk->bytes = 0;
+    blk->kind = FIELD_BLOCK_NONE;
+
+    size_t len = (bytes + QCORE_FIELD_ALIGN - 1) & ~(size_t)(QCORE_FIELD_ALIGN - 1);
+    if (len == 0) return NULL;
+    if (ext_alloc) {
+        void *p = ext_alloc(ext_ctx, len, QCORE_FIELD_ALIGN);
+        if (!p) return NULL;
+        blk->base = p;
+        blk->bytes = len;
+        blk->kind = FIELD_BLOCK_EXTERNAL;
+        return p;
+    }
+    if (len > QCORE_FIELD_POOL_BYTES - field_pool_top) return NULL;
+
+    unsigned char *p = field_pool + field_pool_top;
+    field_pool_top += len;
+    for (size_t i = 0; i < len; i++) p[i] = 0;
+
+    blk->base = p;
+    blk->bytes = len;
+    blk->kind = FIELD_BLOCK_POOL;
+    return p;
+}
+
+void *qcore_field_map_file(FieldBlock *blk, int fd, size_t offset, size_t bytes) {
+    (void)fd;
+    (void)offset;
+    (void)bytes;
+    blk->base = 0;
+    blk->bytes = 0;
+    blk->kind = FIELD_BLOCK_NONE;
+    return 0;
+}
+
+void qcore_field_free(FieldBlock *blk) {
+    if (blk->kind == FIELD_BLOCK_EXTERNAL && ext_free) ext_free(ext_ctx, blk->base, blk->bytes);
+    if (blk->kind == FIELD_BLOCK_POOL &&
+        (unsigned char *)blk->base + blk->bytes == field_pool + field_pool_top) {
+        field_pool_top -= blk->bytes;
+    }
+    blk->base = 0;
+    blk->bytes = 0;
+    blk->kind = FIELD_BLOCK_NONE;
+}
+
+#endif // __STDC_HOSTED__
@@ -0,0 +1,62 @@
+#ifndef QCORE_FIELD_H
+#define QCORE_FIELD_H
+
+#include <stddef.h>
+
+#define QCORE_FIELD_ALIGN 64
+#define QCORE_HUGE_PAGE (2u * 1024u * 1024u)
+
+/**
+ * @brief How a field block was obtained (decides how it is released)
+ */
+typedef enum {
+    FIELD_BLOCK_NONE = 0,
+    FIELD_BLOCK_HEAP,       // posix_memalign (host, small grids)
+    FIELD_BLOCK_MMAP,       // Anonymous mapping (huge pages when possible) or mapped file
+    FIELD_BLOCK_POOL,       // Static kernel pool (freestanding build)
+    FIELD_BLOCK_EXTERNAL    // Allocator set with qcore_field_set_allocator() (kernel)
+} FieldBlockKind;
+
+/**
+ * @brief Backing storage of the toroidal field buffers
+ */
+typedef struct {
+    void *base;             // Start of the block (QCORE_FIELD_ALIGN aligned)
+    size_t bytes;           // Usable size of the block
+    FieldBlockKind kind;
+} FieldBlock;
+
+/**
+ * @brief Allocate a zeroed, QCORE_FIELD_ALIGN-aligned block.
+ *        Blocks of QCORE_HUGE_PAGE or more are mapped with huge pages
+ *        (MAP_HUGETLB, falling back to transparent huge pages).
+ * @return Pointer to the block, or NULL on failure.
+ */
+void *qcore_field_alloc(FieldBlock *blk, size_t bytes);
+
+/**
+ * @brief Map `bytes` of an open file at `offset` as a private copy-on-write
+ *        block: pages are read on first touch, writes never reach the file.
+ *        offset must be a multiple of the page size. Host only.
+ * @return Pointer to the block, or NULL on failure (always in the kernel).
+ */
+void *qcore_field_map_file(FieldBlock *blk, int fd, size_t offset, size_t bytes);
+
+/**
+ * @brief Release a block obtained from qcore_field_alloc() or qcore_field_map_file().
+ */
+void qcore_field_free(FieldBlock *blk);
+
+typedef void *(*QcoreFieldAllocFn)(void *ctx, size_t bytes, size_t align);
+typedef void (*QcoreFieldFreeFn)(void *ctx, void *base, size_t bytes);
+
+/**
+ * @brief Kernel only: take field blocks from an external allocator (the
+ *        boot arena) instead of the static pool. Blocks must come back
+ *        zeroed. free_fn may be NULL; a NULL alloc restores the pool.
+ *        Callbacks rather than a direct call keep the physics core free of
+ *        outside symbols (the SSE build links a renamed copy of it).
+ */
+void qcore_field_set_allocator(QcoreFieldAllocFn alloc, QcoreFieldFreeFn free_fn, void *ctx);
+
+#endif // QCORE_FIELD_H
@@ -1,38 +1,5 @@
 #include "qcore_metriplectic.h"
-
-float k_mod_2pi(float x) {
-    while (x > 2.0f * PI) x -= 2.0f * PI;
-    while (x < 0.0f) x += 2.0f * PI;
-    return x;
-}
-
-float k_sin(float x) {
-    x = k_mod_2pi(x);
-    if (x > PI) return -k_sin(x - PI);
-    if (x > PI/2.0f) return k_cos(x - PI/2.0f);
-    float x2 = x * x;
-    return x * (1.0f - x2 * (1.0f/6.0f - x2 * (1.0f/120.0f - x2 * (1.0f/5040.0f))));
-}
-
-float k_cos(float x) {
-    x = k_mod_2pi(x);
-    if (x > PI) return -k_cos(x - PI);
-    if (x > PI/2.0f) return -k_sin(x - PI/2.0f);
-    float x2 = x * x;
-    return 1.0f - x2 * (0.5f - x2 * (1.0f/24.0f - x2 * (1.0f/720.0f - x2 * (1.0f/40320.0f))));
-}
-
-float k_exp(float x) {
-    // Basic e^x approximation
-    return 1.0f + x + (x*x)/2.0f + (x*x*x)/6.0f;
-}
-
-float k_sqrt(float x) {
-    if (x <= 0) return 0;
-    float res = x;
-    for(int i=0; i<4; i++) res = 0.5f * (res + x/res);
-    return res;
-}
+#include "qcore_torus_simd.h"
 
 float k_phase_lock(float n) {
     // n: Parámetro de evolución (tiempo o índice de nodo)
@@ -48,7 +15,130 @@ float golden_operator(float n) {
     return k_phase_lock(n) * k_phase_lock(n * PHI); 
 }
 
-void init_system(SystemState *state) {
+static const float nodal_amplitudes[4] = {0.8f, 0.4f, 0.2f, 0.1f};
+
+// tanh-like saturation for Z-restriction
+static float nodal_saturate(float nodal_sum) {
+    float z_limit = 2.0f;
+    return nodal_sum / k_sqrt(1.0f + (nodal_sum*nodal_sum)/(z_limit*z_limit));
+}
+
+float nodal_synthesis(float t) {
+    // z(t) = sum(Am cos(wm t + phm)) over modes 2, 4, 8, 16: the eight
+    // phase-lock cosines are evaluated as one array call
+    float args[8], cosv[8];
+    for (int m = 0; m < 4; m++) {
+        float mode_t = t * (float)(2 << m);
+        args[2*m] = PI * mode_t;
+        args[2*m + 1] = PI_PHI_CONST * mode_t;
+    }
+    k_cos_array(args, cosv, 8);
+
+    float nodal_sum = 0.0f;
+    for (int m = 0; m < 4; m++) {
+        nodal_sum += nodal_amplitudes[m] * (cosv[2*m] * cosv[2*m + 1]);
+    }
+    return nodal_saturate(nodal_sum);
+}
+
+int init_system_osc(QcoreOscBank *bank, uint32_t resync_every) {
+    if (qcore_osc_init(bank, OSC_STEP_TERMS, resync_every) != 0) return -1;
+    qcore_osc_set(bank, OSC_PI, PI, 0.0f);
+    qcore_osc_set(bank, OSC_PI_PHI, PI_PHI_CONST, 0.0f);
+    qcore_osc_set(bank, OSC_PHI_PI, PI * PHI, 0.0f);
+    qcore_osc_set(bank, OSC_PHI_PI_PHI, PI_PHI_CONST * PHI, 0.0f);
+    for (int m = 0; m < 4; m++) {
+        float mode = (float)(2 << m);
+        qcore_osc_set(bank, OSC_NODAL + 2*m, PI * mode, 0.0f);
+        qcore_osc_set(bank, OSC_NODAL + 2*m + 1, PI_PHI_CONST * mode, 0.0f);
+    }
+    for (int i = 0; i < 4; i++) {
+        float shift = (float)i * (PI / 2.0f);
+        qcore_osc_set(bank, OSC_CORE + 2*i, PI, PI * shift);
+        qcore_osc_set(bank, OSC_CORE + 2*i + 1, PI * PHI, PI * PHI * shift);
+    }
+    return 0;
+}
+
+// The bank stands at the end of this step (solve_step moved it there)
+static const QcoreOscBank *step_bank(const SystemState *state) {
+    const QcoreOscBank *bank = state->osc;
+    if (bank && bank->synced && bank->t == state->time) return bank;
+    return 0;
+}
+
+/**
+ * @brief The phase factors a step needs, each evaluated once: from the
+ *        phase bank when given one, otherwise directly (the same products
+ *        as k_phase_lock / golden_operator).
+ */
+typedef struct {
+    float lock;             // k_phase_lock(t)
+    float on;               // golden_operator(t)
+    float on_mid;           // golden_operator(t - dt/2), Strang only
+} StepPhases;
+
+static void step_phases(const SystemState *state, const QcoreOscBank *bank, float dt,
+                        StepPhases *ph) {
+    int strang = (state->integrator == INTEGRATOR_STRANG);
+    if (bank) {
+        ph->lock = qcore_osc_cos(bank, OSC_PI) * qcore_osc_cos(bank, OSC_PI_PHI);
+        ph->on = ph->lock * (qcore_osc_cos(bank, OSC_PHI_PI) * qcore_osc_cos(bank, OSC_PHI_PI_PHI));
+        ph->on_mid = strang ? (qcore_osc_cos_mid(bank, OSC_PI) * qcore_osc_cos_mid(bank, OSC_PI_PHI)) *
+                              (qcore_osc_cos_mid(bank, OSC_PHI_PI) * qcore_osc_cos_mid(bank, OSC_PHI_PI_PHI))
+                            : 0.0f;
+        return;
+    }
+    ph->lock = k_phase_lock(state->time);
+    ph->on = ph->lock * k_phase_lock(state->time * PHI);
+    ph->on_mid = strang ? golden_operator(state->time - 0.5f * dt) : 0.0f;
+}
+
+// One re/im plane rounded up to the field alignment
+static size_t torus_plane_bytes(int torus_dim) {
+    size_t cells = (size_t)torus_dim * (size_t)torus_dim;
+    return (cells * sizeof(float) + QCORE_FIELD_ALIGN - 1) & ~(size_t)(QCORE_FIELD_ALIGN - 1);
+}
+
+size_t system_field_bytes(int torus_dim) {
+    size_t rows = ((size_t)torus_dim * sizeof(float) + QCORE_FIELD_ALIGN - 1) & ~(size_t)(QCORE_FIELD_ALIGN - 1);
+    return 2 * torus_plane_bytes(torus_dim) + rows;
+}
+
+void attach_system_field(SystemState *state, int torus_dim, const FieldBlock *field) {
+    // Separate re/im buffers, each starting on its own 64-byte boundary,
+    // followed by the per-row reduction scratch
+    unsigned char *base = (unsigned char *)field->base;
+    size_t plane = torus_plane_bytes(torus_dim);
+    state->field = *field;
+    state->torus_dim = torus_dim;
+    state->phi_re = (float *)base;
+    state->phi_im = (float *)(base + plane);
+    state->row_sums = (float *)(base + 2 * plane);
+    state->executor.parallel_for = 0;
+    state->executor.bus_report = 0;
+    state->executor.ctx = 0;
+    // Run settings start at their defaults for fresh and restored states
+    state->integrator = INTEGRATOR_EULER;
+    state->osc = 0;
+    for (int g = 0; g < DIAG_GROUPS; g++) {
+        state->observe.period[g] = 1;
+        state->observe.pending[g] = 0;
+        state->observe.elapsed[g] = 0.0f;
+    }
+}
+
+int init_system(SystemState *state) {
+    return init_system_dim(state, TORUS_DIM);
+}
+
+int init_system_dim(SystemState *state, int torus_dim) {
+    if (torus_dim < 1 || torus_dim > TORUS_DIM_MAX) return -1;
+
+    FieldBlock field;
+    if (!qcore_field_alloc(&field, system_field_bytes(torus_dim))) return -1;
+    attach_system_field(state, torus_dim, &field);
+
     state->time = 0.0f;
     state->kink_amplitude = 10.0f;
     state->stability = 50.0f;
@@ -91,14 +181,51 @@ void init_system(SystemState *state) {
     state->bus.packet_loss = 0.0f;
 
     // Initialize Φ on T^2 with a quasiperiodic wave
-    for (int i = 0; i < TORUS_DIM; i++) {
-        for (int j = 0; j < TORUS_DIM; j++) {
-            float theta = (float)i * 2.0f * PI / TORUS_DIM;
-            float phi = (float)j * 2.0f * PI / TORUS_DIM;
-            state->phi_re[i][j] = k_cos(theta);
-            state->phi_im[i][j] = k_cos(phi * PHI); // Parity-Locked Mapping
+    for (int i = 0; i < torus_dim; i++) {
+        for (int j = 0; j < torus_dim; j++) {
+            float theta = (float)i * 2.0f * PI / torus_dim;
+            float phi = (float)j * 2.0f * PI / torus_dim;
+            state->phi_re[TORUS_AT(state, i, j)] = k_cos(theta);
+            state->phi_im[TORUS_AT(state, i, j)] = k_cos(phi * PHI); // Parity-Locked Mapping
         }
     }
+    return 0;
+}
+
+int copy_system(SystemState *dst, const SystemState *src) {
+    if (dst == src) return 0;
+    if (dst->torus_dim != src->torus_dim) return -1;
+
+    // Scalars by value, field by content: dst keeps its own buffers
+    // and its own executor and phase bank
+    float *re = dst->phi_re;
+    float *im = dst->phi_im;
+    float *row_sums = dst->row_sums;
+    FieldBlock field = dst->field;
+    TorusExecutor executor = dst->executor;
+    QcoreOscBank *osc = dst->osc;
+    *dst = *src;
+    dst->phi_re = re;
+    dst->phi_im = im;
+    dst->row_sums = row_sums;
+    dst->field = field;
+    dst->executor = executor;
+    dst->osc = osc;
+
+    size_t cells = (size_t)src->torus_dim * (size_t)src->torus_dim;
+    for (size_t k = 0; k < cells; k++) {
+        re[k] = src->phi_re[k];
+        im[k] = src->phi_im[k];
+    }
+    return 0;
+}
+
+void release_system(SystemState *state) {
+    qcore_field_free(&state->field);
+    state->phi_re = 0;
+    state->phi_im = 0;
+    state->row_sums = 0;
+    state->torus_dim = 0;
 }
 
 float compute_sync_clock(SystemState *state) {
@@ -106,56 +233,150 @@ float compute_sync_clock(SystemState *state) {
     float On = golden_operator(state->time);
     float energy_on = On * On; // Use energy density for observable c
     
-    for (int i = 0; i < TORUS_DIM; i++) {
-        for (int j = 0; j < TORUS_DIM; j++) {
-            float intensity = state->phi_re[i][j]*state->phi_re[i][j] + 
-                             state->phi_im[i][j]*state->phi_im[i][j];
-            sum += intensity * energy_on;
-        }
+    int cells = state->torus_dim * state->torus_dim;
+    for (int k = 0; k < cells; k++) {
+        float intensity = state->phi_re[k]*state->phi_re[k] + 
+                         state->phi_im[k]*state->phi_im[k];
+        sum += intensity * energy_on;
     }
-    return sum / (float)(TORUS_DIM * TORUS_DIM);
+    return sum / (float)cells;
 }
 
-void apply_breathing_projector(SystemState *state, float dt) {
-    float On = golden_operator(state->time);
-    float dtheta = On * dt * 2.0f; // Angular evolution
-    
-    float cos_dt = k_cos(dtheta);
-    float sin_dt = k_sin(dtheta);
-    
+/**
+ * @brief Per-step coefficients of the selected breathing scheme.
+ *        state->time is already the end of the step.
+ */
+static void breathing_drive(const SystemState *state, float dt, const StepPhases *ph,
+                            TorusDrive *drive) {
+    float On = ph->on;
     float decay = (100.0f - state->stability) * 0.002f;
     float pump = (state->shear_flow / 10.0f) * 0.1f; // Target intensity drive
 
-    for (int i = 0; i < TORUS_DIM; i++) {
-        for (int j = 0; j < TORUS_DIM; j++) {
-            float r = state->phi_re[i][j];
-            float im = state->phi_im[i][j];
-            
-            // 1. Unitary Rotation (Hamiltonian / Reversible)
-            state->phi_re[i][j] = r * cos_dt - im * sin_dt;
-            state->phi_im[i][j] = r * sin_dt + im * cos_dt;
-            
-            // 2. Metriplectic Drive (Metric / Irreversible)
-            // Pulls intensity towards 1.0, modulated by stability/decay
-            float intensity = state->phi_re[i][j]*state->phi_re[i][j] + 
-                             state->phi_im[i][j]*state->phi_im[i][j];
-            float drive = (1.0f - intensity) * pump;
-            
-            state->phi_re[i][j] += state->phi_re[i][j] * (drive - decay) * dt;
-            state->phi_im[i][j] += state->phi_im[i][j] * (drive - decay) * dt;
+    drive->decay = decay;
+    drive->pump = pump;
+    drive->dt = dt;
+    drive->energy_on = On * On; // Use energy density for observable c
+    drive->strang = (state->integrator == INTEGRATOR_STRANG);
+    drive->relax_e = 1.0f;
+    drive->relax_pq = 0.0f;
+
+    if (!drive->strang) {
+        float dtheta = On * dt * 2.0f; // Angular evolution
+        k_sincos(dtheta, &drive->sin_dt, &drive->cos_dt);
+        return;
+    }
+
+    // Rotation rate sampled at the midpoint (second order in dt)
+    float dtheta = ph->on_mid * dt * 2.0f;
+    k_sincos(dtheta, &drive->sin_dt, &drive->cos_dt);
+
+    // Each half step of dΦ/dt = Φ·(a - pump·|Φ|²), a = pump - decay, is
+    // |Φ|² -> |Φ|² / (e + pump·q·|Φ|²) with e = exp(-a·dt), q = (1 - e)/a
+    float a = pump - decay;
+    float x = a * dt;
+    float e = k_exp(-x);
+    float q = (x > 1e-3f || x < -1e-3f) ? (1.0f - e) / a : dt * (1.0f - 0.5f * x);
+    drive->relax_e = e;
+    drive->relax_pq = pump * q;
+}
+
+// Exact half step of the Strang drive: |Φ|² -> |Φ|² / (e + pump·q·|Φ|²)
+static void relax_half(float *re, float *im, const TorusDrive *d) {
+    float scale = 1.0f / k_sqrt_accurate(d->relax_e + d->relax_pq * (*re * *re + *im * *im));
+    *re *= scale;
+    *im *= scale;
+}
+
+void apply_breathing_projector(SystemState *state, float dt) {
+    // Plain per-cell loop, kept apart from the fused torus kernels as the
+    // reference they are checked against
+    StepPhases ph;
+    TorusDrive drive;
+    step_phases(state, 0, dt, &ph);
+    breathing_drive(state, dt, &ph, &drive);
+
+    int cells = state->torus_dim * state->torus_dim;
+    for (int k = 0; k < cells; k++) {
+        float r = state->phi_re[k];
+        float im = state->phi_im[k];
+
+        if (drive.strang) {
+            // Half drive, full rotation, half drive
+            relax_half(&r, &im, &drive);
+            state->phi_re[k] = r * drive.cos_dt - im * drive.sin_dt;
+            state->phi_im[k] = r * drive.sin_dt + im * drive.cos_dt;
+            relax_half(&state->phi_re[k], &state->phi_im[k], &drive);
+            continue;
         }
+
+        // 1. Unitary Rotation (Hamiltonian / Reversible)
+        state->phi_re[k] = r * drive.cos_dt - im * drive.sin_dt;
+        state->phi_im[k] = r * drive.sin_dt + im * drive.cos_dt;
+
+        // 2. Metriplectic Drive (Metric / Irreversible)
+        // Pulls intensity towards 1.0, modulated by stability/decay
+        float intensity = state->phi_re[k]*state->phi_re[k] +
+                         state->phi_im[k]*state->phi_im[k];
+        float pull = (1.0f - intensity) * drive.pump;
+
+        state->phi_re[k] += state->phi_re[k] * (pull - drive.decay) * dt;
+        state->phi_im[k] += state->phi_im[k] * (pull - drive.decay) * dt;
+    }
+}
+
+typedef struct {
+    SystemState *state;
+    const TorusDrive *drive;
+} BreathingRows;
+
+static void breathing_rows(void *arg, int row_begin, int row_end) {
+    BreathingRows *task = (BreathingRows *)arg;
+    SystemState *state = task->state;
+    int dim = state->torus_dim;
+    torus_fused_rows(state->phi_re + row_begin * dim, state->phi_im + row_begin * dim,
+                     row_end - row_begin, dim, task->drive, state->row_sums + row_begin);
+}
+
+/**
+ * @brief Breathing projector + sync clock in one pass over the torus.
+ *        Same per-cell update as apply_breathing_projector(); the intensity
+ *        reduction of compute_sync_clock() rides along on the updated cells.
+ *
+ * With an executor attached, row bands run in parallel. Each row is
+ * reduced on its own and the row sums are added in row order, so
+ * sync_clock_c does not depend on how rows were split across workers.
+ */
+static float breathing_sync_step(SystemState *state, float dt, const StepPhases *ph) {
+    TorusDrive drive;
+    breathing_drive(state, dt, ph, &drive);
+
+    int cells = state->torus_dim * state->torus_dim;
+    if (state->executor.parallel_for) {
+        BreathingRows task = {state, &drive};
+        state->executor.parallel_for(state->executor.ctx, state->torus_dim, breathing_rows, &task);
+        float sum = 0.0f;
+        for (int i = 0; i < state->torus_dim; i++) sum += state->row_sums[i];
+        return sum / (float)cells;
     }
+
+    float sum = torus_fused_update(state->phi_re, state->phi_im, cells, &drive);
+    return sum / (float)cells;
 }
 
 void solve_step(SystemState *state, float dt) {
     state->time += dt;
 
+    // Fixed-frequency cosines of this step: one rotation of the phase
+    // bank when attached, otherwise direct trig shared by every consumer
+    if (state->osc) qcore_osc_follow(state->osc, state->time, dt);
+    StepPhases ph;
+    step_phases(state, step_bank(state), dt, &ph);
+
     // 1. Classical Canal (Shear Flow)
     float target_stability = (state->shear_flow >= 9.9f) ? 100.0f : (state->shear_flow * 8.0f);
     
-    // 2. Toroidal Modulation
-    apply_breathing_projector(state, dt);
-    state->sync_clock_c = compute_sync_clock(state);
+    // 2. Toroidal Modulation (fused rotate + drive + sync clock reduction)
+    state->sync_clock_c = breathing_sync_step(state, dt, &ph);
     
     if (state->sync_clock_c > 0.5f) {
         state->global_identity += state->sync_clock_c * dt * 0.1f;
@@ -163,7 +384,7 @@ void solve_step(SystemState *state, float dt) {
 
     // 3. Metriplectic Coupling
     // La estabilidad solo aumenta si estamos en "Fase Segura"
-    float phase_coherence = k_phase_lock(state->time);
+    float phase_coherence = ph.lock;
     float stability_gate = phase_coherence * phase_coherence; // Cuadrado para rectificar (energía)
 
     float tor_boost = (state->sync_clock_c > 0.0f) ? state->sync_clock_c * 10.0f : 0.0f;
@@ -173,7 +394,7 @@ void solve_step(SystemState *state, float dt) {
     state->stability += d_metr * dt;
 
     // 5. Solenoid HAL & RMS Control (The "Physical Filter")
-    float v_pulse = hal_launder_step(&state->launder, state->time);
+    float v_pulse = hal_launder_step_on(&state->launder, state->time, ph.on);
     
     // The filter is the magnetic field effect: B = mu * I
     state->solenoid_filter = 1.0f / (1.0f + (v_pulse * 0.1f));
@@ -209,48 +430,115 @@ void solve_step(SystemState *state, float dt) {
         state->stability -= state->audio_energy * 10.0f * dt;
     }
 
-    // 7. Nodal Synthesis z(t) = sum(Am cos(wm t + phm))
-    // Science decided: Use k_phase_lock for efficiency and tanh-like saturation for Z-restriction
-    float nodal_sum = 0.0f;
-    float m_amplitudes[] = {0.8f, 0.4f, 0.2f, 0.1f}; // Am for modes 2, 4, 8, 16
-    for (int m = 0; m < 4; m++) {
-        float mode_idx = (float)(2 << m); // 2, 4, 8, 16
-        nodal_sum += m_amplitudes[m] * k_phase_lock(state->time * mode_idx);
+    solve_step_observe(state, dt);
+}
+
+// 7. Nodal Synthesis z(t) = sum(Am cos(wm t + phm))
+// Science decided: Use k_phase_lock for efficiency and tanh-like saturation for Z-restriction
+static void observe_nodal(SystemState *state, const QcoreOscBank *bank) {
+    if (bank) {
+        float nodal_sum = 0.0f;
+        for (int m = 0; m < 4; m++) {
+            nodal_sum += nodal_amplitudes[m] * (qcore_osc_cos(bank, OSC_NODAL + 2*m) *
+                                                qcore_osc_cos(bank, OSC_NODAL + 2*m + 1));
+        }
+        state->vortex_z = nodal_saturate(nodal_sum);
+    } else {
+        state->vortex_z = nodal_synthesis(state->time);
     }
-    float z_limit = 2.0f;
-    state->vortex_z = nodal_sum / k_sqrt(1.0f + (nodal_sum*nodal_sum)/(z_limit*z_limit));
+}
 
-    // 8. Protocol Alpha: Benchmark Analysis
+// 8. Protocol Alpha: Benchmark Analysis. l2_error is an EMA of every
+// step's sync clock, so its update runs each step the group is not off;
+// thermal_eff follows the schedule
+static void observe_l2(SystemState *state) {
     float ns_baseline = (state->shear_flow >= 9.9f) ? 0.0625f : (state->shear_flow / 10.0f) * 0.0625f;
     float diff = ns_baseline - state->sync_clock_c;
     state->l2_error = (0.995f * state->l2_error) + (0.005f * (diff * diff));
-    
+}
+
+static void observe_alpha(SystemState *state) {
     float heat_penalty = (state->temperature - 22.0f) * 0.1f;
     state->thermal_eff = (state->stability * 1.5f) / (1.0f + heat_penalty + state->entropy_rate);
-    
-    // 9. Barbashin-LaSalle Diagnostics
+}
+
+// 9. Barbashin-LaSalle Diagnostics; dV/dt over the time since the last update
+static void observe_lasalle(SystemState *state, float elapsed) {
     // Lyapunov Candidate V = 0.5*(100-rho)^2 + 0.5*(V_rms - PHI)^2
     float rho_err = 100.0f - state->stability;
     float phi_err = state->launder.current_rms - PHI;
     float v_new = 0.5f * (rho_err * rho_err + phi_err * phi_err);
     
-    state->lyapunov_dot = (v_new - state->lyapunov_v) / dt;
+    state->lyapunov_dot = (v_new - state->lyapunov_v) / elapsed;
     state->lyapunov_v = v_new;
     
     // Convergence Criteria for Maximal Invariant Set
     state->is_lasalle_locked = (state->stability > 98.0f && (phi_err * phi_err) < 0.001f);
+}
 
-    // 9. Inter-core Interaction
+// 9. Inter-core Interaction
+static void observe_bus(SystemState *state, const QcoreOscBank *bank) {
+    if (state->executor.bus_report) {
+        // Real cores ran the torus bands: report what they measured
+        state->executor.bus_report(state->executor.ctx, &state->bus);
+        return;
+    }
     for(int i=0; i<4; i++) {
         // Each core synchronizes based on the golden operator phase shift
-        float core_phase = state->time + (float)i * (PI / 2.0f);
-        float core_op = k_cos(PI * core_phase) * k_cos(PI * PHI * core_phase);
+        float core_op;
+        if (bank) {
+            core_op = qcore_osc_cos(bank, OSC_CORE + 2*i) * qcore_osc_cos(bank, OSC_CORE + 2*i + 1);
+        } else {
+            float core_phase = state->time + (float)i * (PI / 2.0f);
+            core_op = k_cos(PI * core_phase) * k_cos(PI * PHI * core_phase);
+        }
         state->bus.core_sync[i] = (state->stability / 100.0f) * (core_op * 0.5f + 0.5f);
     }
-    
+
     // Bus throughput is maximized when core_sync is balanced and stability is high
     state->bus.bus_throughput = state->node_density * state->bus.core_sync[0];
     state->bus.packet_loss = (100.0f - state->stability) / 100.0f;
+}
+
+static void observe_group(SystemState *state, int group, const QcoreOscBank *bank) {
+    QcoreObservables *obs = &state->observe;
+    switch (group) {
+        case DIAG_NODAL:   observe_nodal(state, bank); break;
+        case DIAG_ALPHA:   observe_alpha(state); break;
+        case DIAG_LASALLE: observe_lasalle(state, obs->elapsed[group]); break;
+        default:           observe_bus(state, bank); break;
+    }
+    obs->pending[group] = 0;
+    obs->elapsed[group] = 0.0f;
+}
+
+void set_system_diagnostics(SystemState *state, int group, int32_t period) {
+    if (group < 0 || group >= DIAG_GROUPS || period < DIAG_LAZY) return;
+    state->observe.period[group] = period;
+}
+
+void system_observe(SystemState *state) {
+    const QcoreOscBank *bank = step_bank(state);
+    for (int g = 0; g < DIAG_GROUPS; g++) {
+        if (state->observe.period[g] != DIAG_OFF && state->observe.pending[g]) {
+            observe_group(state, g, bank);
+        }
+    }
+}
+
+void solve_step_observe(SystemState *state, float dt) {
+    const QcoreOscBank *bank = step_bank(state);
+    QcoreObservables *obs = &state->observe;
+
+    // Groups run in their original order; lazy ones only count the gap
+    for (int g = 0; g < DIAG_GROUPS; g++) {
+        int32_t period = obs->period[g];
+        if (period == DIAG_OFF) continue;
+        if (g == DIAG_ALPHA) observe_l2(state);
+        obs->pending[g]++;
+        obs->elapsed[g] += dt;
+        if (period > 0 && obs->pending[g] >= (uint32_t)period) observe_group(state, g, bank);
+    }
 
     if (state->stability < 0) state->stability = 0;
     if (state->stability > 100) state->stability = 100;
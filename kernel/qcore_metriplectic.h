@@ -3,15 +3,19 @@
 
 #include <stdint.h>
 #include "hal_golden_launder.h"
+#include "qcore_field.h"
+#include "k_math.h"
+#include "qcore_osc.h"
 
 #define PHI 1.618033988f
 #define PI  3.141592653f
 #define PI_PHI_CONST 5.083203692f 
 
 /**
- * @brief Toroidal Field Integration Size
+ * @brief Toroidal Field Integration Size (default N for an N x N grid)
  */
 #define TORUS_DIM 8
+#define TORUS_DIM_MAX 1024
 
 /**
  * @brief Inter-core Communication Bus
@@ -22,6 +26,80 @@ typedef struct {
     float packet_loss;      // Error rate on the manifold
 } CoreBus;
 
+/**
+ * @brief Work over rows [row_begin, row_end) of the torus
+ */
+typedef void (*TorusRowFn)(void *arg, int row_begin, int row_end);
+
+/**
+ * @brief Optional parallel executor for the torus update.
+ *        parallel_for must cover rows [0, rows) exactly once, split into
+ *        bands across its workers, and return after every band is done.
+ *        bus_report, if set, fills the CoreBus from what the workers
+ *        measured during the last parallel_for instead of the modelled
+ *        phase-shifted cores. A zeroed executor keeps solve_step serial.
+ */
+typedef struct {
+    void (*parallel_for)(void *ctx, int rows, TorusRowFn fn, void *arg);
+    void (*bus_report)(void *ctx, CoreBus *bus);
+    void *ctx;
+} TorusExecutor;
+
+/**
+ * @brief Time integration of the breathing projector
+ *        EULER: exact rotation, explicit Euler drive (the original scheme).
+ *        STRANG: exact drive over dt/2, rotation at the midpoint rate,
+ *        exact drive over dt/2; stable for any dt.
+ */
+typedef enum {
+    INTEGRATOR_EULER = 0,
+    INTEGRATOR_STRANG
+} QcoreIntegrator;
+
+/**
+ * @brief Oscillators of the solve_step phase bank (init_system_osc).
+ *        Every fixed-frequency cosine of a step: the four factors of
+ *        golden_operator(t), the nodal modes and the phase-shifted cores.
+ */
+enum {
+    OSC_PI = 0,             // cos(π·t)
+    OSC_PI_PHI,             // cos(PI_PHI_CONST·t)
+    OSC_PHI_PI,             // cos(π·Φ·t)
+    OSC_PHI_PI_PHI,         // cos(PI_PHI_CONST·Φ·t)
+    OSC_NODAL,              // 8: cos(π·m·t), cos(PI_PHI_CONST·m·t) for m = 2, 4, 8, 16
+    OSC_CORE = OSC_NODAL + 8, // 8: cos(π·s), cos(π·Φ·s) for s = t + i·π/2, i = 0..3
+    OSC_STEP_TERMS = OSC_CORE + 8
+};
+
+/**
+ * @brief Diagnostic groups of solve_step_observe. None of them feeds back
+ *        into the dynamics, so turning one down never changes the run.
+ */
+enum {
+    DIAG_NODAL = 0,         // vortex_z
+    DIAG_ALPHA,             // l2_error, thermal_eff (Protocol Alpha)
+    DIAG_LASALLE,           // lyapunov_v, lyapunov_dot, is_lasalle_locked
+    DIAG_BUS,               // CoreBus
+    DIAG_GROUPS
+};
+
+#define DIAG_OFF  0         // Never computed: the values freeze
+#define DIAG_LAZY (-1)      // Computed by system_observe() only
+
+/**
+ * @brief When each diagnostic group is computed: period k >= 1 means on
+ *        every k-th step (1, the default, is every step), or DIAG_OFF /
+ *        DIAG_LAZY. Decimation stays exact: the l2_error EMA folds in
+ *        every step (a few flops) unless Alpha is off, and lyapunov_dot is
+ *        the slope over the time since the last update. Lazy groups see
+ *        the state after the step's stability clamp.
+ */
+typedef struct {
+    int32_t period[DIAG_GROUPS];
+    uint32_t pending[DIAG_GROUPS];  // Steps since the group was computed
+    float elapsed[DIAG_GROUPS];     // Time since the group was computed
+} QcoreObservables;
+
 /**
  * @brief El Mandato Metriplético: Estructura de Sistema Dinámico (Toroidal-Sheared)
  */
@@ -32,8 +110,15 @@ typedef struct {
     float shear_flow;       // v (Control: Mach 10 create canal)
     
     // Toroidal Field Φ (Re, Im) for the compact manifold T^2
-    float phi_re[TORUS_DIM][TORUS_DIM];
-    float phi_im[TORUS_DIM][TORUS_DIM];
+    int torus_dim;          // N: grid resolution chosen at init time
+    float *phi_re;          // [N * N] row-major, 64-byte aligned
+    float *phi_im;          // [N * N] row-major, 64-byte aligned
+    float *row_sums;        // [N] per-row partial sums (parallel reduction)
+    FieldBlock field;       // Backing storage of phi_re / phi_im / row_sums
+    TorusExecutor executor; // Parallel row bands (zeroed: serial)
+    QcoreIntegrator integrator; // Breathing projector scheme (init: Euler)
+    QcoreOscBank *osc;      // Phase bank for the step's cosines (NULL: direct trig)
+    QcoreObservables observe; // Diagnostic schedule (init: every group, every step)
     
     float sync_clock_c;     // Scalar Observable c (Energy from compact dimensions)
     float global_identity;  // Persistent angle I_global
@@ -80,21 +165,32 @@ typedef struct {
     float L_metr;           // Componente Métrica (Entropía)
 } Lagrangian;
 
-// Physics Core
-void init_system(SystemState *state);
+/**
+ * @brief Flat index of torus cell (i, j)
+ */
+#define TORUS_AT(state, i, j) ((i) * (state)->torus_dim + (j))
+
+// Physics Core. init_system*() allocate the field (-1 if that fails or N is
+// out of range): pair each successful init with release_system() before the
+// state is initialised again or dropped.
+int init_system(SystemState *state);                    // N = TORUS_DIM
+int init_system_dim(SystemState *state, int torus_dim); // 1 <= N <= TORUS_DIM_MAX
+int copy_system(SystemState *dst, const SystemState *src); // Same N; dst keeps buffers + executor
+void release_system(SystemState *state);
+size_t system_field_bytes(int torus_dim);                  // Field block size for an N x N torus
+void attach_system_field(SystemState *state, int torus_dim, const FieldBlock *field); // Point Φ into field, zero executor + osc, default diagnostics
+int init_system_osc(QcoreOscBank *bank, uint32_t resync_every); // OSC_STEP_TERMS bank for state->osc
 void compute_lagrangian(const SystemState *state, Lagrangian *L);
 float golden_operator(float n);
 float k_phase_lock(float n); 
+float nodal_synthesis(float t);     // vortex_z(t): modes 2, 4, 8, 16, saturated
 void solve_step(SystemState *state, float dt);
+void solve_step_observe(SystemState *state, float dt); // Sampled tail of solve_step: scheduled diagnostics, clamp
+void set_system_diagnostics(SystemState *state, int group, int32_t period); // DIAG_* group: k >= 1, DIAG_OFF or DIAG_LAZY
+void system_observe(SystemState *state); // Bring lazy and decimated groups up to date (call before reading them)
 
 // Toroidal specific operations
 float compute_sync_clock(SystemState *state);
 void apply_breathing_projector(SystemState *state, float dt);
 
-// Freestanding math stubs
-float k_sin(float x);
-float k_cos(float x);
-float k_exp(float x);
-float k_sqrt(float x);
-
 #endif // QCORE_METRIPLECTIC_H
@@ -0,0 +1,151 @@
+#include "qcore_osc.h"
+#include "k_math.h"
+
+#define OSC_TWO_PI 6.283185307179586
+#define OSC_INV_TWO_PI 0.15915494309189535
+
+// omega·t + phase formed in double and wrapped to [-pi, pi]: high modes at
+// large t keep the phase a float product would round away
+static float osc_angle(float omega, float t, float phase) {
+    double x = (double)omega * (double)t + (double)phase;
+    double turns = x * OSC_INV_TWO_PI;
+    if (!(turns < 1e9 && turns > -1e9)) return (float)x;
+    int n = (int)(turns + (turns >= 0.0 ? 0.5 : -0.5));
+    return (float)(x - (double)n * OSC_TWO_PI);
+}
+
+// One array of the bank rounded up to the field alignment
+static size_t osc_array_bytes(int count) {
+    size_t bytes = (size_t)count * sizeof(float);
+    return (bytes + QCORE_FIELD_ALIGN - 1) & ~(size_t)(QCORE_FIELD_ALIGN - 1);
+}
+
+int qcore_osc_init(QcoreOscBank *bank, int count, uint32_t resync_every) {
+    if (count < 1) return -1;
+    size_t array = osc_array_bytes(count);
+    unsigned char *base = (unsigned char *)qcore_field_alloc(&bank->block, 8 * array);
+    if (!base) return -1;
+
+    // Zeroed block: omega 0, phase 0, rotators rebuilt on the first step
+    bank->omega = (float *)base;
+    bank->phase = (float *)(base + array);
+    bank->re = (float *)(base + 2 * array);
+    bank->im = (float *)(base + 3 * array);
+    bank->rot_re = (float *)(base + 4 * array);
+    bank->rot_im = (float *)(base + 5 * array);
+    bank->half_re = (float *)(base + 6 * array);
+    bank->half_im = (float *)(base + 7 * array);
+    bank->count = count;
+    bank->t = 0.0f;
+    bank->dt = 0.0f;
+    bank->synced = 0;
+    bank->resync_every = resync_every;
+    bank->since_sync = 0;
+    bank->steps = 0;
+    bank->syncs = 0;
+    bank->renorms = 0;
+    bank->rebuilds = 0;
+    return 0;
+}
+
+void qcore_osc_release(QcoreOscBank *bank) {
+    qcore_field_free(&bank->block);
+    bank->count = 0;
+    bank->synced = 0;
+}
+
+void qcore_osc_set(QcoreOscBank *bank, int k, float omega, float phase) {
+    if (k < 0 || k >= bank->count) return;
+    bank->omega[k] = omega;
+    bank->phase[k] = phase;
+    bank->synced = 0;
+    bank->dt = 0.0f;
+}
+
+void qcore_osc_sync(QcoreOscBank *bank, float t) {
+    for (int k = 0; k < bank->count; k++) {
+        k_sincos_accurate(osc_angle(bank->omega[k], t, bank->phase[k]), &bank->im[k], &bank->re[k]);
+    }
+    bank->t = t;
+    bank->synced = 1;
+    bank->since_sync = 0;
+    bank->syncs++;
+}
+
+static void build_rotators(QcoreOscBank *bank, float dt) {
+    for (int k = 0; k < bank->count; k++) {
+        k_sincos_accurate(osc_angle(bank->omega[k], dt, 0.0f), &bank->rot_im[k], &bank->rot_re[k]);
+        k_sincos_accurate(osc_angle(bank->omega[k], 0.5f * dt, 0.0f), &bank->half_im[k], &bank->half_re[k]);
+    }
+    bank->dt = dt;
+    bank->rebuilds++;
+}
+
+// z *= 1.5 - 0.5·|z|²: one Newton step toward |z| = 1
+static void renormalize(QcoreOscBank *bank) {
+    float *restrict re = bank->re;
+    float *restrict im = bank->im;
+    for (int k = 0; k < bank->count; k++) {
+        float s = 1.5f - 0.5f * (re[k] * re[k] + im[k] * im[k]);
+        re[k] *= s;
+        im[k] *= s;
+    }
+    bank->renorms++;
+}
+
+static void rotate(QcoreOscBank *bank) {
+    float *restrict re = bank->re;
+    float *restrict im = bank->im;
+    const float *restrict rr = bank->rot_re;
+    const float *restrict ri = bank->rot_im;
+    for (int k = 0; k < bank->count; k++) {
+        float r = re[k] * rr[k] - im[k] * ri[k];
+        float i = re[k] * ri[k] + im[k] * rr[k];
+        re[k] = r;
+        im[k] = i;
+    }
+    bank->steps++;
+}
+
+void qcore_osc_advance(QcoreOscBank *bank, float dt) {
+    qcore_osc_follow(bank, bank->t + dt, dt);
+}
+
+void qcore_osc_follow(QcoreOscBank *bank, float t, float dt) {
+    // A float clock does not move by dt exactly: t - (t - dt) is dt rounded
+    // to the clock's ulp, which only changes when t crosses a power of two.
+    // Rotating by that difference keeps the phasors on the clock.
+    int stepped = bank->synced && bank->t + dt == t;
+    float step = stepped ? t - bank->t : dt;
+    if (step != bank->dt) build_rotators(bank, step);
+
+    if (!stepped || (bank->resync_every && bank->since_sync + 1 >= bank->resync_every)) {
+        qcore_osc_sync(bank, t);
+        return;
+    }
+
+    rotate(bank);
+    bank->t = t;
+    bank->since_sync++;
+    if (bank->since_sync % QCORE_OSC_RENORM_EVERY == 0) renormalize(bank);
+}
+
+float qcore_osc_drift(const QcoreOscBank *bank) {
+    float worst = 0.0f;
+    for (int k = 0; k < bank->count; k++) {
+        float s, c;
+        k_sincos_accurate(osc_angle(bank->omega[k], bank->t, bank->phase[k]), &s, &c);
+        float dr = bank->re[k] - c;
+        float di = bank->im[k] - s;
+        float d = k_sqrt_accurate(dr * dr + di * di);
+        if (d > worst) worst = d;
+    }
+    return worst;
+}
+
+float qcore_osc_sum(const QcoreOscBank *bank, int first, int n, const float *amp) {
+    const float *re = bank->re + first;
+    float sum = 0.0f;
+    for (int j = 0; j < n; j++) sum += amp[j] * re[j];
+    return sum;
+}
@@ -0,0 +1,113 @@
+#ifndef QCORE_OSC_H
+#define QCORE_OSC_H
+
+#include <stdint.h>
+#include "qcore_field.h"
+
+/*
+ * Phase-accumulator oscillator bank.
+ *
+ * Every oscillator k is a fixed-frequency term cos(omega_k·t + phase_k)
+ * kept as the unit phasor z_k = exp(i·(omega_k·t + phase_k)). Moving the
+ * bank forward by dt is one complex multiply per term,
+ *
+ *   z_k <- z_k · exp(i·omega_k·dt)
+ *
+ * with the rotators rebuilt only when the step changes. Re(z_k) and Im(z_k) are
+ * then the cosine and sine at the bank time, and the half-step rotators
+ * give the value at t - dt/2 for another multiply.
+ *
+ * Rounding makes |z_k| wander and the phase drift away from the direct
+ * evaluation. |z_k| is pulled back to 1 every QCORE_OSC_RENORM_EVERY
+ * steps (one Newton step of 1/sqrt, no division), and the phasors are
+ * re-anchored by direct k_sincos every `resync_every` steps. The bank
+ * also re-anchors whenever it is asked to follow a time it did not
+ * reach by its own steps. Direct evaluations form omega·t + phase in
+ * double, so they stay exact for the bank's float t at any frequency.
+ *
+ * The bank follows the caller's float clock, not n·dt: a clock t += dt
+ * really advances by dt rounded to its ulp, and the bank rotates by that
+ * amount (it changes, and the rotators are rebuilt, only when t crosses
+ * a power of two). Values therefore match direct evaluation at the clock
+ * up to rotation rounding, even for high modes at large t.
+ *
+ * Arrays are structure-of-arrays in one field block, so banks of
+ * thousands of terms advance in vectorizable passes.
+ */
+
+#define QCORE_OSC_RENORM_EVERY 32
+
+typedef struct {
+    int count;              // Oscillators in the bank
+    float *omega;           // Angular frequency (rad per unit t)
+    float *phase;           // Phase at t = 0
+    float *re;              // cos(omega·t + phase) at the bank time
+    float *im;              // sin(omega·t + phase)
+    float *rot_re;          // exp(i·omega·dt)
+    float *rot_im;
+    float *half_re;         // exp(i·omega·dt/2)
+    float *half_im;
+    float t;                // Time the phasors stand at
+    float dt;               // Clock step the rotators were built for (0: none yet)
+    int synced;             // Phasors are valid for t
+    uint32_t resync_every;  // Steps between direct re-anchoring (0: only on demand)
+    uint32_t since_sync;    // Steps since the last re-anchoring
+    uint64_t steps;         // Rotations applied
+    uint64_t syncs;         // Direct re-anchorings
+    uint64_t renorms;       // Amplitude corrections
+    uint64_t rebuilds;      // Rotator rebuilds (step changes)
+    FieldBlock block;       // Backing storage of the arrays
+} QcoreOscBank;
+
+/**
+ * @brief Allocate a bank of `count` oscillators, all at omega = 0, phase 0.
+ * @return 0, or -1 on bad arguments or allocation failure.
+ */
+int qcore_osc_init(QcoreOscBank *bank, int count, uint32_t resync_every);
+void qcore_osc_release(QcoreOscBank *bank);
+
+/**
+ * @brief Set oscillator k to cos(omega·t + phase). The bank re-anchors
+ *        on its next sync, follow or advance.
+ */
+void qcore_osc_set(QcoreOscBank *bank, int k, float omega, float phase);
+
+/**
+ * @brief Evaluate every phasor directly at time t.
+ */
+void qcore_osc_sync(QcoreOscBank *bank, float t);
+
+/**
+ * @brief Rotate every phasor by dt and move the bank time by dt.
+ */
+void qcore_osc_advance(QcoreOscBank *bank, float dt);
+
+/**
+ * @brief Put the bank at time t, reached by the clock update t = t0 + dt:
+ *        one rotation when the bank stood at t0, a direct sync otherwise.
+ *        Callers pass the same dt they added to their clock.
+ */
+void qcore_osc_follow(QcoreOscBank *bank, float t, float dt);
+
+/**
+ * @brief Largest |z_k - exp(i·(omega_k·t + phase_k))| over the bank,
+ *        against direct evaluation at the bank time.
+ */
+float qcore_osc_drift(const QcoreOscBank *bank);
+
+/**
+ * @brief sum(amp[j] · cos_k) over oscillators k = first .. first + n - 1.
+ */
+float qcore_osc_sum(const QcoreOscBank *bank, int first, int n, const float *amp);
+
+static inline float qcore_osc_cos(const QcoreOscBank *bank, int k) { return bank->re[k]; }
+static inline float qcore_osc_sin(const QcoreOscBank *bank, int k) { return bank->im[k]; }
+
+/**
+ * @brief cos(omega_k·(t - dt/2) + phase_k), dt the clock step of the last follow.
+ */
+static inline float qcore_osc_cos_mid(const QcoreOscBank *bank, int k) {
+    return bank->re[k] * bank->half_re[k] + bank->im[k] * bank->half_im[k];
+}
+
+#endif // QCORE_OSC_H
@@ -0,0 +1,129 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "qcore_pool.h"
+
+typedef struct {
+    QcorePool *pool;
+    int index;
+} PoolWorker;
+
+struct QcorePool {
+    int threads;
+    pthread_t *tids;
+    PoolWorker *workers;
+    pthread_barrier_t start;    // Caller publishes a job, workers pick it up
+    pthread_barrier_t done;     // Every band finished
+
+    // Workers hold until the barriers are sized to the threads that started
+    pthread_mutex_t lock;
+    pthread_cond_t ready_cv;
+    int ready;
+
+    // Current job (written by the caller before the start barrier)
+    TorusRowFn fn;
+    void *arg;
+    int rows;
+    int shutdown;
+};
+
+static void run_band(QcorePool *pool, int index) {
+    int begin = (int)((long long)pool->rows * index / pool->threads);
+    int end = (int)((long long)pool->rows * (index + 1) / pool->threads);
+    if (begin < end) pool->fn(pool->arg, begin, end);
+}
+
+static void *worker_main(void *p) {
+    PoolWorker *w = (PoolWorker *)p;
+    QcorePool *pool = w->pool;
+
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->ready) pthread_cond_wait(&pool->ready_cv, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (;;) {
+        pthread_barrier_wait(&pool->start);
+        if (pool->shutdown) break;
+        run_band(pool, w->index);
+        pthread_barrier_wait(&pool->done);
+    }
+    return NULL;
+}
+
+QcorePool *qcore_pool_create(int threads) {
+    if (threads < 1) return NULL;
+    QcorePool *pool = calloc(1, sizeof(QcorePool));
+    if (!pool) return NULL;
+    pool->threads = threads;
+    pool->tids = calloc((size_t)threads, sizeof(pthread_t));
+    pool->workers = calloc((size_t)threads, sizeof(PoolWorker));
+    if (!pool->tids || !pool->workers) {
+        free(pool->tids);
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->ready_cv, NULL);
+
+    // Participant 0 is the calling thread; run with the workers that start
+    int started = 1;
+    for (int i = 1; i < threads; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (pthread_create(&pool->tids[i], NULL, worker_main, &pool->workers[i]) != 0) break;
+        started++;
+    }
+    pool->threads = started;
+    pthread_barrier_init(&pool->start, NULL, (unsigned)started);
+    pthread_barrier_init(&pool->done, NULL, (unsigned)started);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->ready = 1;
+    pthread_cond_broadcast(&pool->ready_cv);
+    pthread_mutex_unlock(&pool->lock);
+    return pool;
+}
+
+void qcore_pool_destroy(QcorePool *pool) {
+    if (!pool) return;
+    pool->shutdown = 1;
+    pthread_barrier_wait(&pool->start);
+    for (int i = 1; i < pool->threads; i++) pthread_join(pool->tids[i], NULL);
+    pthread_barrier_destroy(&pool->start);
+    pthread_barrier_destroy(&pool->done);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->ready_cv);
+    free(pool->tids);
+    free(pool->workers);
+    free(pool);
+}
+
+int qcore_pool_threads(const QcorePool *pool) {
+    return pool ? pool->threads : 1;
+}
+
+int qcore_pool_default_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int)n : 1;
+}
+
+void qcore_pool_parallel_for(void *p, int rows, TorusRowFn fn, void *arg) {
+    QcorePool *pool = (QcorePool *)p;
+    if (pool->threads == 1) {
+        fn(arg, 0, rows);
+        return;
+    }
+    pool->fn = fn;
+    pool->arg = arg;
+    pool->rows = rows;
+    pthread_barrier_wait(&pool->start);
+    run_band(pool, 0);
+    pthread_barrier_wait(&pool->done);
+}
+
+void qcore_pool_attach(QcorePool *pool, SystemState *state) {
+    state->executor.parallel_for = pool ? qcore_pool_parallel_for : 0;
+    state->executor.bus_report = 0;
+    state->executor.ctx = pool;
+}
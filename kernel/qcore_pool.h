@@ -0,0 +1,37 @@
+#ifndef QCORE_POOL_H
+#define QCORE_POOL_H
+
+#include "qcore_metriplectic.h"
+
+/**
+ * @brief Persistent pthread pool for the torus row bands (host only).
+ *        Workers are created once and meet the caller at a barrier for
+ *        every parallel_for; the caller runs band 0 itself.
+ */
+typedef struct QcorePool QcorePool;
+
+/**
+ * @brief Start a pool of `threads` participants (caller included).
+ * @return The pool, or NULL on failure or threads < 1.
+ */
+QcorePool *qcore_pool_create(int threads);
+void qcore_pool_destroy(QcorePool *pool);
+int qcore_pool_threads(const QcorePool *pool);
+
+/**
+ * @brief Online CPU count (at least 1).
+ */
+int qcore_pool_default_threads(void);
+
+/**
+ * @brief TorusExecutor entry point: rows are split into one contiguous
+ *        band per participant; returns when every band is done.
+ */
+void qcore_pool_parallel_for(void *pool, int rows, TorusRowFn fn, void *arg);
+
+/**
+ * @brief Route state's torus update through the pool (NULL: back to serial).
+ */
+void qcore_pool_attach(QcorePool *pool, SystemState *state);
+
+#endif // QCORE_POOL_H
@@ -0,0 +1,71 @@
+#include <stddef.h>
+#include "qcore_ring.h"
+
+static void copy_bytes(unsigned char *dst, const unsigned char *src, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) dst[i] = src[i];
+}
+
+int qcore_ring_init(QcoreRing *ring, void *storage, uint32_t rec_bytes, uint32_t capacity) {
+    if (!storage || rec_bytes == 0 || capacity == 0 || (capacity & (capacity - 1)) != 0) return -1;
+    atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, 0, memory_order_relaxed);
+    ring->tail_cache = 0;
+    ring->head_cache = 0;
+    ring->slots = (unsigned char *)storage;
+    ring->rec_bytes = rec_bytes;
+    ring->mask = capacity - 1;
+    return 0;
+}
+
+int qcore_ring_push(QcoreRing *ring, const void *rec) {
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head - ring->tail_cache > ring->mask) {
+        ring->tail_cache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        if (head - ring->tail_cache > ring->mask) return -1;
+    }
+    copy_bytes(ring->slots + (size_t)(head & ring->mask) * ring->rec_bytes,
+               (const unsigned char *)rec, ring->rec_bytes);
+    // Publish the record before the new head
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return 0;
+}
+
+uint32_t qcore_ring_peek(QcoreRing *ring, const void **first) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (ring->head_cache == tail) {
+        ring->head_cache = atomic_load_explicit(&ring->head, memory_order_acquire);
+    }
+    uint32_t avail = ring->head_cache - tail;
+    uint32_t index = tail & ring->mask;
+    uint32_t to_wrap = ring->mask + 1 - index;
+    *first = ring->slots + (size_t)index * ring->rec_bytes;
+    return (avail < to_wrap) ? avail : to_wrap;
+}
+
+void qcore_ring_consume(QcoreRing *ring, uint32_t n) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    // Done reading the slots before the producer may reuse them
+    atomic_store_explicit(&ring->tail, tail + n, memory_order_release);
+}
+
+uint32_t qcore_ring_pop(QcoreRing *ring, void *dst, uint32_t max) {
+    unsigned char *out = (unsigned char *)dst;
+    uint32_t total = 0;
+    // At most two runs: up to the wrap point, then from slot 0
+    for (int pass = 0; pass < 2 && total < max; pass++) {
+        const void *first;
+        uint32_t n = qcore_ring_peek(ring, &first);
+        if (n == 0) break;
+        if (n > max - total) n = max - total;
+        copy_bytes(out + (size_t)total * ring->rec_bytes, (const unsigned char *)first, n * ring->rec_bytes);
+        qcore_ring_consume(ring, n);
+        total += n;
+    }
+    return total;
+}
+
+uint32_t qcore_ring_count(QcoreRing *ring) {
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return head - tail;
+}
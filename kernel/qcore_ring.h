@@ -0,0 +1,54 @@
+#ifndef QCORE_RING_H
+#define QCORE_RING_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define QCORE_CACHE_LINE 64
+
+/**
+ * @brief Lock-free single-producer / single-consumer ring of fixed-size
+ *        records over caller-provided storage (no allocation, usable in
+ *        the freestanding build).
+ *
+ * head and tail are free-running counters on separate cache lines; each
+ * side also keeps a private copy of the other side's counter and only
+ * re-reads the shared one when the ring looks full (producer) or empty
+ * (consumer). Neither side ever blocks.
+ */
+typedef struct {
+    // Producer line
+    _Alignas(QCORE_CACHE_LINE) _Atomic uint32_t head;
+    uint32_t tail_cache;
+    // Consumer line
+    _Alignas(QCORE_CACHE_LINE) _Atomic uint32_t tail;
+    uint32_t head_cache;
+    // Read-only after init
+    _Alignas(QCORE_CACHE_LINE) unsigned char *slots;
+    uint32_t rec_bytes;
+    uint32_t mask;
+} QcoreRing;
+
+/**
+ * @brief storage must hold capacity * rec_bytes bytes; capacity must be a
+ *        power of two.
+ * @return 0 on success, -1 on a bad capacity or record size.
+ */
+int qcore_ring_init(QcoreRing *ring, void *storage, uint32_t rec_bytes, uint32_t capacity);
+
+// Producer side
+int qcore_ring_push(QcoreRing *ring, const void *rec);      // 0, or -1 if full
+
+// Consumer side
+/**
+ * @brief Contiguous run of readable records starting at *first (stops at
+ *        the wrap point); release them with qcore_ring_consume().
+ */
+uint32_t qcore_ring_peek(QcoreRing *ring, const void **first);
+void qcore_ring_consume(QcoreRing *ring, uint32_t n);
+uint32_t qcore_ring_pop(QcoreRing *ring, void *dst, uint32_t max); // Copying peek + consume
+
+// Either side (a snapshot; may be stale by the time it returns)
+uint32_t qcore_ring_count(QcoreRing *ring);
+
+#endif // QCORE_RING_H
@@ -0,0 +1,141 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "qcore_runner.h"
+#include "qcore_ring.h"
+#include "qcore_snapshot.h"
+
+#define RUNNER_COMMANDS 64u   // Power of two
+#define RUNNER_REPUBLISH_SEC (1.0 / 240.0)   // Max age of an unread snapshot
+#define SHEAR_MAX 10.0f
+
+typedef struct {
+    float shear_delta;
+} RunnerCommand;
+
+struct QcoreRunner {
+    QcoreSnapshot snapshot;
+    QcoreRing commands;
+    RunnerCommand command_slots[RUNNER_COMMANDS];
+    SystemState *state;
+    RunnerConfig config;
+    pthread_t thread;
+    _Atomic int stop;
+    _Atomic uint64_t steps;
+};
+
+double qcore_monotonic_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void apply_commands(QcoreRunner *r) {
+    RunnerCommand cmd;
+    while (qcore_ring_pop(&r->commands, &cmd, 1) == 1) {
+        float shear = r->state->shear_flow + cmd.shear_delta;
+        r->state->shear_flow = (shear < 0.0f) ? 0.0f : (shear > SHEAR_MAX) ? SHEAR_MAX : shear;
+    }
+}
+
+static void add_ns(struct timespec *t, long ns) {
+    t->tv_nsec += ns;
+    while (t->tv_nsec >= 1000000000L) {
+        t->tv_nsec -= 1000000000L;
+        t->tv_sec++;
+    }
+}
+
+static int before(const struct timespec *a, const struct timespec *b) {
+    return a->tv_sec < b->tv_sec || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+static void *physics_thread(void *p) {
+    QcoreRunner *r = (QcoreRunner *)p;
+    long period_ns = (r->config.rate_hz > 0.0f) ? (long)(1e9 / r->config.rate_hz) : 0;
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    double published_at = 0.0;
+
+    while (!atomic_load_explicit(&r->stop, memory_order_acquire)) {
+        apply_commands(r);
+        if (r->config.before_step) r->config.before_step(r->state, r->config.user);
+        solve_step(r->state, r->config.dt);
+        if (r->config.after_step) r->config.after_step(r->state, r->config.user);
+        atomic_fetch_add_explicit(&r->steps, 1, memory_order_relaxed);
+
+        double now_sec = qcore_monotonic_sec();
+        if (qcore_snapshot_consumed(&r->snapshot) || now_sec - published_at >= RUNNER_REPUBLISH_SEC) {
+            qcore_snapshot_publish(&r->snapshot, r->state);
+            published_at = now_sec;
+        }
+
+        if (period_ns > 0) {
+            add_ns(&deadline, period_ns);
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            if (before(&deadline, &now)) {
+                deadline = now;   // Fell behind: drop the backlog rather than burst
+                continue;
+            }
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {}
+        }
+    }
+    return NULL;
+}
+
+QcoreRunner *qcore_runner_start(SystemState *state, const RunnerConfig *config) {
+    QcoreRunner *r = calloc(1, sizeof(QcoreRunner));
+    if (!r) return NULL;
+    r->state = state;
+    r->config = *config;
+    qcore_ring_init(&r->commands, r->command_slots, sizeof(RunnerCommand), RUNNER_COMMANDS);
+    if (qcore_snapshot_init(&r->snapshot, state) != 0) {
+        free(r);
+        return NULL;
+    }
+    if (pthread_create(&r->thread, NULL, physics_thread, r) != 0) {
+        qcore_snapshot_release(&r->snapshot);
+        free(r);
+        return NULL;
+    }
+    return r;
+}
+
+void qcore_runner_stop(QcoreRunner *r) {
+    if (!r) return;
+    atomic_store_explicit(&r->stop, 1, memory_order_release);
+    pthread_join(r->thread, NULL);
+    apply_commands(r);   // Changes queued after the last step still land
+    qcore_snapshot_release(&r->snapshot);
+    free(r);
+}
+
+const SystemState *qcore_runner_snapshot(QcoreRunner *r) {
+    return qcore_snapshot_read(&r->snapshot);
+}
+
+int qcore_runner_adjust_shear(QcoreRunner *r, float delta) {
+    RunnerCommand cmd = {delta};
+    return qcore_ring_push(&r->commands, &cmd);
+}
+
+uint64_t qcore_runner_steps(const QcoreRunner *r) {
+    return atomic_load_explicit(&r->steps, memory_order_relaxed);
+}
+
+double qcore_rate_update(QcoreRate *rate, uint64_t count, double now) {
+    if (rate->last_time == 0.0) {
+        rate->last_time = now;
+        rate->last_count = count;
+        return rate->rate;
+    }
+    double elapsed = now - rate->last_time;
+    if (elapsed >= QCORE_RATE_WINDOW) {
+        rate->rate = (double)(count - rate->last_count) / elapsed;
+        rate->last_count = count;
+        rate->last_time = now;
+    }
+    return rate->rate;
+}
@@ -0,0 +1,74 @@
+#ifndef QCORE_RUNNER_H
+#define QCORE_RUNNER_H
+
+#include <stdint.h>
+#include "qcore_metriplectic.h"
+
+/*
+ * Physics on its own thread (host only).
+ *
+ * The runner owns the caller's SystemState from start to stop and steps
+ * it at a fixed rate or flat out. After a step it publishes a copy
+ * through a QcoreSnapshot when the renderer has taken the previous one
+ * or the unread one is older than 1/240 s. Flat out, copies are thus
+ * bounded by the frame rate (or 240/s), and a read is never more than
+ * one frame or 1/240 s behind physics. Controls from the UI travel
+ * through an SPSC command ring (qcore_ring.h) and are applied between
+ * steps.
+ */
+
+typedef void (*RunnerHook)(SystemState *state, void *user);
+
+typedef struct {
+    float dt;               // Simulated seconds per step
+    float rate_hz;          // Steps per wall-clock second; 0: flat out
+    RunnerHook before_step; // Physics thread, before each step (may be NULL)
+    RunnerHook after_step;  // Physics thread, after each step (may be NULL)
+    void *user;
+} RunnerConfig;
+
+typedef struct QcoreRunner QcoreRunner;
+
+/**
+ * @brief Start stepping state on a new thread.
+ *        The caller must not touch state until qcore_runner_stop().
+ * @return The runner, or NULL on failure.
+ */
+QcoreRunner *qcore_runner_start(SystemState *state, const RunnerConfig *config);
+
+/**
+ * @brief Join the physics thread; state then holds the final step.
+ */
+void qcore_runner_stop(QcoreRunner *runner);
+
+/**
+ * @brief Newest published state; never blocks (one render thread only).
+ *        Valid until the next call.
+ */
+const SystemState *qcore_runner_snapshot(QcoreRunner *runner);
+
+/**
+ * @brief Queue a shear_flow change, clamped to [0, 10] when applied.
+ * @return 0 if queued, -1 if the command ring was full.
+ */
+int qcore_runner_adjust_shear(QcoreRunner *runner, float delta);
+
+uint64_t qcore_runner_steps(const QcoreRunner *runner);
+
+/**
+ * @brief Events per second from a monotonically increasing counter,
+ *        refreshed at most every QCORE_RATE_WINDOW seconds.
+ */
+#define QCORE_RATE_WINDOW 0.5
+
+typedef struct {
+    uint64_t last_count;
+    double last_time;
+    double rate;
+} QcoreRate;
+
+double qcore_rate_update(QcoreRate *rate, uint64_t count, double now);
+
+double qcore_monotonic_sec(void);
+
+#endif // QCORE_RUNNER_H
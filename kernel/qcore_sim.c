@@ -1,189 +1,302 @@
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <X11/keysym.h>
 #include "qcore_metriplectic.h"
 #include "hal_audio_host.h"
+#include "qcore_pool.h"
+#include "qcore_checkpoint.h"
+#include "qcore_trace.h"
+#include "qcore_runner.h"
+#include "qcore_view.h"
 
 #define WIDTH 800
 #define HEIGHT 600
+#define FRAME_SEC (1.0 / 60.0)
 
-static const char *banner_lines[] = {
-    "  @@@@@@ @@@@@@@@@@   @@@@@@  @@@@@@@   @@@@@@ @@@ @@@  @@@@@@",
-    " !@@     @@! @@! @@! @@!  @@@ @@!  @@@ !@@     @@! !@@ !@@    ",
-    "  !@@!!  @!! !!@ @!@ @!@  !@! @!@@!@!   !@@!!   !@!@!   !@@!! ",
-    "     !:! !!:     !!: !!:  !!! !!:          !:!   !!:       !:!",
-    " ::.: :   :      :    : :. :   :       ::.: :    .:    ::.: : "
-};
-
-void draw_banner_x11(Display *display, Window window, GC gc, SystemState *state) {
-    int start_x = 50;
-    int start_y = 30;
-    int char_w = 7;
-    int char_h = 12;
-
-    int scanline_x = (int)(state->time * 300.0f) % WIDTH;
-
-    unsigned long base_color = 0x22d3ee; // Cyan
-    unsigned long alt_color = 0x3b82f6;  // Blue
-
-    if (state->stability < 40.0f) {
-        base_color = 0xef4444; // Red
-        alt_color = 0x475569;  // Slate
-    } else if (state->stability < 70.0f) {
-        base_color = 0x22d3ee; // Cyan
-        alt_color = 0xd946ef;  // Magenta
-    }
-
-    for (int y = 0; y < 5; y++) {
-        const char *line = banner_lines[y];
-        for (int x = 0; line[x] != '\0'; x++) {
-            if (line[x] == ' ') continue;
-
-            int px = start_x + x * char_w;
-            int py = start_y + y * char_h;
-
-            XSetForeground(display, gc, (x % 2 == 0) ? base_color : alt_color);
-            
-            // Scanline
-            if (px > scanline_x - 15 && px < scanline_x + 15) {
-                XSetForeground(display, gc, 0xFFFFFF);
-            }
+// One frame = one image: qcore_view rasterizes into the image's pixels,
+// then a single XShmPutImage (XPutImage when the server cannot share
+// memory, e.g. a remote display) puts it on screen
+typedef struct {
+    Display *display;
+    Window window;
+    GC gc;
+    XImage *image;
+    XShmSegmentInfo shm;
+    int use_shm;
+    QcoreFramebuffer fb;
+} Presenter;
 
-            // Glitch
-            if (state->stability < 50.0f) {
-                if (((int)(state->time * 50) % 7) == y) {
-                    XSetForeground(display, gc, (state->stability < 30.0f) ? 0xef4444 : 0xfacc15);
-                }
-            }
+static int shm_failed;
 
-            char c[2] = {line[x], '\0'};
-            XDrawString(display, window, gc, px, py, c, 1);
+static int shm_error_handler(Display *display, XErrorEvent *error) {
+    (void)display;
+    (void)error;
+    shm_failed = 1;
+    return 0;
+}
+
+static int presenter_attach_shm(Presenter *p, Visual *visual, int depth, int w, int h) {
+    if (!XShmQueryExtension(p->display)) return -1;
+    p->image = XShmCreateImage(p->display, visual, depth, ZPixmap, NULL, &p->shm, w, h);
+    if (!p->image) return -1;
+    p->shm.shmid = shmget(IPC_PRIVATE, (size_t)p->image->bytes_per_line * h, IPC_CREAT | 0600);
+    if (p->shm.shmid >= 0) {
+        p->shm.shmaddr = p->image->data = shmat(p->shm.shmid, NULL, 0);
+        p->shm.readOnly = False;
+        shm_failed = (p->shm.shmaddr == (char *)-1);
+        if (!shm_failed) {
+            // Attach errors arrive asynchronously: sync under a local handler
+            XErrorHandler old = XSetErrorHandler(shm_error_handler);
+            XShmAttach(p->display, &p->shm);
+            XSync(p->display, False);
+            XSetErrorHandler(old);
+            if (shm_failed) shmdt(p->shm.shmaddr);
         }
+        shmctl(p->shm.shmid, IPC_RMID, NULL); // Freed once both sides detach
+        if (!shm_failed) return 0;
     }
+    p->image->data = NULL;
+    XDestroyImage(p->image);
+    p->image = NULL;
+    return -1;
 }
 
-void draw_ui(Display *display, Window window, GC gc, SystemState *state) {
-    XClearWindow(display, window);
-
-    // Dynamic Banner
-    draw_banner_x11(display, window, gc, state);
-
-    // Header Decal
-    XSetForeground(display, gc, 0x3b82f6); // Blue
-    XDrawString(display, window, gc, 20, 110, "QUOREMIND SIM // INTEGRATED TOROIDAL-SHEAR MODEL v3.0", 54);
-    
-    char buf[128];
-    sprintf(buf, "STABILITY: %.2f %% // SHEAR_FLOW: %.2f", state->stability, state->shear_flow);
-    XDrawString(display, window, gc, 20, 130, buf, strlen(buf));
-
-    sprintf(buf, "Bitstream: %.2f bits/s", state->bit_stream);
-    XDrawString(display, window, gc, 20, 150, buf, strlen(buf));
-    
-    // Audio Diagnostics
-    sprintf(buf, "Acoustic Load: %.2f", state->audio_energy);
-    XSetForeground(display, gc, 0xa78bfa);
-    XDrawString(display, window, gc, 20, 170, buf, strlen(buf));
-    if (state->audio_coherence > 0.5f) {
-        XSetForeground(display, gc, 0x10b981);
-        XDrawString(display, window, gc, 20, 185, "RECOGNITION: LOCKED", 19);
-    }
-    
-    sprintf(buf, "CLOCK_C: %.4f // GLOBAL_ID: %.2f rad", state->sync_clock_c, state->global_identity);
-    XSetForeground(display, gc, (state->sync_clock_c > 0.5) ? 0x10b981 : 0x60a5fa);
-    XDrawString(display, window, gc, 20, 205, buf, strlen(buf));
-
-    sprintf(buf, "BUS_THROUGHPUT: %.2f // BREATHING: %.2f", state->bus.bus_throughput, state->breathing_state);
-    XDrawString(display, window, gc, 20, 225, buf, strlen(buf));
-
-    sprintf(buf, "LAUNDER V: %.1f [Duty: %.2f] // FILTER: %.2f", state->launder.last_v, state->launder.duty_cycle, state->solenoid_filter);
-    XSetForeground(display, gc, (state->launder.last_v > 0.1) ? 0xfacc15 : 0x475569);
-    XDrawString(display, window, gc, 20, 245, buf, strlen(buf));
-
-    sprintf(buf, "TEMPERATURE: %.2f C // ENTROPY_RATE: %.4f", state->temperature, state->entropy_rate);
-    XSetForeground(display, gc, (state->temperature > 50.0) ? 0xef4444 : 0x22d3ee);
-    XDrawString(display, window, gc, 20, 265, buf, strlen(buf));
-
-    int cx = WIDTH / 2;
-    int cy = HEIGHT / 2;
-
-    // 1. Draw the Sheared Channel (Z-Pinch)
-    // Intensity modulated by solenoid filter
-    XSetForeground(display, gc, (state->shear_flow > 9.0) ? 0xFFFFFF : 0x94a3b8);
-    for (int i = 0; i < 20; i++) {
-        float y_off = (float)i * 15.0f - 150.0f;
-        float amp = (100.0f - state->stability) * 0.5f;
-        int x_off = (int)(k_sin(state->time * 3.0f + (float)i * 0.5f) * amp);
-        
-        if (state->solenoid_filter > 0.7f) {
-            XFillRectangle(display, window, gc, cx + x_off - 10, cy + (int)y_off, 20, 10);
-        }
-        
-        // Photonic Packets (Only if unfiltered)
-        if (state->breathing_state > 0.5f && (int)(state->time * 10) % 20 == i && state->solenoid_filter > 0.8f) {
-            XSetForeground(display, gc, 0xfacc15); // Yellow
-            XFillArc(display, window, gc, cx + x_off - 5, cy + (int)y_off, 10, 10, 0, 360*64);
-            XSetForeground(display, gc, (state->shear_flow > 9.0) ? 0xFFFFFF : 0x94a3b8);
+static int presenter_init(Presenter *p, Display *display, Window window, GC gc, int w, int h) {
+    memset(p, 0, sizeof(*p));
+    p->display = display;
+    p->window = window;
+    p->gc = gc;
+    int screen = DefaultScreen(display);
+    Visual *visual = DefaultVisual(display, screen);
+    int depth = DefaultDepth(display, screen);
+
+    p->use_shm = (presenter_attach_shm(p, visual, depth, w, h) == 0);
+    if (!p->use_shm) {
+        char *data = malloc((size_t)w * h * 4);
+        p->image = data ? XCreateImage(display, visual, depth, ZPixmap, 0, data, w, h, 32, 0) : NULL;
+        if (!p->image) {
+            free(data);
+            return -1;
         }
     }
+    p->fb.pixels = (uint32_t *)p->image->data;
+    p->fb.width = w;
+    p->fb.height = h;
+    p->fb.stride = p->image->bytes_per_line / 4;
+    // QcoreFramebuffer pixels are 0x00RRGGBB: needs a 32-bpp TrueColor visual
+    return (p->image->bits_per_pixel == 32) ? 0 : -1;
+}
 
-    // 2. Draw Toroidal Modulation (Resonance)
-    XSetForeground(display, gc, (state->sync_clock_c > 0.5) ? 0x22d3ee : 0x3b82f6);
-    for (int i = 0; i < TORUS_DIM; i++) {
-        for (int j = 0; j < TORUS_DIM; j++) {
-                float intensity = state->phi_re[i][j] * state->phi_re[i][j] + state->phi_im[i][j] * state->phi_im[i][j];
-                if (intensity > 0.1 && state->solenoid_filter > 0.7f) {
-                    float angle = (float)i * (2.0f * PI / TORUS_DIM) + state->global_identity;
-                    float radius = 100.0f + (float)j * 15.0f + intensity * 10.0f;
-                
-                int px = cx + (int)(k_cos(angle) * radius);
-                // Apply Nodal Bobbing to Y
-                int py = cy + (int)(k_sin(angle) * radius + state->vortex_z * 15.0f);
-                
-                int size = (state->breathing_state > 0.5f) ? 6 : 3;
-                if (state->solenoid_filter < 0.85f && size == 6) size = 3;
-                
-                XFillArc(display, window, gc, px - size/2, py - size/2, size, size, 0, 360*64);
-            }
+static void presenter_show(Presenter *p) {
+    if (p->use_shm) {
+        XShmPutImage(p->display, p->window, p->gc, p->image, 0, 0, 0, 0, p->fb.width, p->fb.height, False);
+        XSync(p->display, False); // The server is done reading before the next frame is drawn
+    } else {
+        XPutImage(p->display, p->window, p->gc, p->image, 0, 0, 0, 0, p->fb.width, p->fb.height);
+        XFlush(p->display);
+    }
+}
+
+static void presenter_release(Presenter *p) {
+    if (!p->image) return;
+    if (p->use_shm) {
+        XShmDetach(p->display, &p->shm);
+        XSync(p->display, False);
+        shmdt(p->shm.shmaddr);
+        p->image->data = NULL;
+    }
+    XDestroyImage(p->image); // Frees the malloc'd pixels on the XPutImage path
+    p->image = NULL;
+}
+
+// "--name N" integer options (--torus-dim, --threads, --steps, --checkpoint-every, --physics-hz)
+static int parse_int_option(int argc, char **argv, const char *name, int fallback) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], name) == 0) return atoi(argv[i + 1]);
+    }
+    return fallback;
+}
+
+static const char *parse_str_option(int argc, char **argv, const char *name) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], name) == 0) return argv[i + 1];
+    }
+    return NULL;
+}
+
+static int has_flag(int argc, char **argv, const char *name) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) return 1;
+    }
+    return 0;
+}
+
+// --integrator euler|strang (NULL: euler); -1 for anything else
+static int parse_integrator(const char *name) {
+    if (!name || strcmp(name, "euler") == 0) return INTEGRATOR_EULER;
+    if (strcmp(name, "strang") == 0) return INTEGRATOR_STRANG;
+    return -1;
+}
+
+// --diagnostics every|lazy|off|K for every group (NULL: every step);
+// -2 for anything else. Lazy groups are computed when a snapshot or trace
+// record is taken.
+static int parse_diagnostics(const char *mode) {
+    if (!mode || strcmp(mode, "every") == 0) return 1;
+    if (strcmp(mode, "lazy") == 0) return DIAG_LAZY;
+    if (strcmp(mode, "off") == 0) return DIAG_OFF;
+    int k = atoi(mode);
+    return (k >= 1) ? k : -2;
+}
+
+static void set_diagnostics(SystemState *state, int period) {
+    for (int g = 0; g < DIAG_GROUPS; g++) set_system_diagnostics(state, g, period);
+}
+
+// --resume picks up the --checkpoint file when there is one; the
+// integrator is a run setting and is not stored in checkpoints
+static int start_system(SystemState *state, int torus_dim, const char *ckpt, int resume,
+                        QcoreIntegrator integrator) {
+    if (resume && ckpt && access(ckpt, F_OK) == 0) {
+        if (qcore_checkpoint_restore(state, ckpt) != 0) {
+            fprintf(stderr, "Cannot resume from %s (corrupt or other format version)\n", ckpt);
+            return -1;
         }
+        fprintf(stderr, "Resumed from %s at t=%.3f (step %llu)\n", ckpt, state->time,
+                (unsigned long long)state->launder.step_count);
+        state->integrator = integrator;
+        return 0;
+    }
+    if (init_system_dim(state, torus_dim) != 0) {
+        fprintf(stderr, "Invalid --torus-dim %d (1..%d)\n", torus_dim, TORUS_DIM_MAX);
+        return -1;
     }
+    state->integrator = integrator;
+    return 0;
+}
 
-    // 3. Core Sync Meters
-    for(int i=0; i<4; i++) {
-        XSetForeground(display, gc, 0x475569);
-        XDrawRectangle(display, window, gc, 650, 450 + i*30, 100, 20);
-        int fill = (int)(state->bus.core_sync[i] * 100);
-        XSetForeground(display, gc, (fill > 80) ? 0x10b981 : 0x3b82f6);
-        XFillRectangle(display, window, gc, 650, 450 + i*30, fill, 20);
-        sprintf(buf, "C%d", i);
-        XDrawString(display, window, gc, 630, 465 + i*30, buf, 2);
+// --phase-bank: the step's fixed-frequency cosines come from a phasor
+// bank instead of direct trig (close to, not bit-identical with, the
+// direct path); like the integrator, a run setting
+#define PHASE_BANK_RESYNC 256
+
+static int attach_phase_bank(SystemState *state, QcoreOscBank *bank) {
+    if (init_system_osc(bank, PHASE_BANK_RESYNC) != 0) {
+        fprintf(stderr, "Cannot allocate the phase bank\n");
+        return -1;
     }
+    state->osc = bank;
+    return 0;
+}
+
+static void checkpoint_step(const SystemState *state, const char *ckpt, int every) {
+    if (ckpt && qcore_checkpoint_tick(state, ckpt, (uint64_t)every) < 0) {
+        fprintf(stderr, "Checkpoint to %s failed\n", ckpt);
+    }
+}
+
+// Runner hooks: audio and checkpoints stay on the physics thread
+typedef struct {
+    const char *ckpt;
+    int every;
+} CheckpointHook;
+
+static void audio_hook(SystemState *state, void *user) {
+    (void)user;
+    hal_audio_poll(state);
+}
 
-    XFlush(display);
+// Capture health once the physics loop has stopped polling
+static void report_audio(void) {
+    AudioCaptureStats st;
+    hal_audio_stats(&st);
+    if (st.periods == 0) return;
+    fprintf(stderr, "[AUDIO] %llu periods, %llu xruns, %llu dropped, mic-to-state %.2f ms mean, %.2f ms max\n",
+            (unsigned long long)st.periods, (unsigned long long)st.xruns, (unsigned long long)st.dropped,
+            st.latency.mean_ns * 1e-6, (double)st.latency.max_ns * 1e-6);
 }
 
-int main() {
+static void checkpoint_hook(SystemState *state, void *user) {
+    const CheckpointHook *hook = (const CheckpointHook *)user;
+    checkpoint_step(state, hook->ckpt, hook->every);
+}
+
+int main(int argc, char **argv) {
     Display *display;
     Window window;
     XEvent event;
     int screen;
+    int torus_dim = parse_int_option(argc, argv, "--torus-dim", TORUS_DIM);
+    int threads = parse_int_option(argc, argv, "--threads", 0); // 0: serial torus update
+    QcorePool *pool = (threads > 0) ? qcore_pool_create(threads) : NULL;
+    const char *ckpt = parse_str_option(argc, argv, "--checkpoint");
+    int ckpt_every = parse_int_option(argc, argv, "--checkpoint-every", 1000);
+    int resume = has_flag(argc, argv, "--resume");
+    int integrator = parse_integrator(parse_str_option(argc, argv, "--integrator"));
+    int phase_bank = has_flag(argc, argv, "--phase-bank");
+    int diagnostics = parse_diagnostics(parse_str_option(argc, argv, "--diagnostics"));
+    if (diagnostics < DIAG_LAZY) {
+        fprintf(stderr, "Unknown --diagnostics (every, lazy, off or a step count)\n");
+        return 1;
+    }
+    QcoreOscBank bank = {0};
+    if (integrator < 0) {
+        fprintf(stderr, "Unknown --integrator (euler or strang)\n");
+        return 1;
+    }
 
     display = getenv("DISPLAY") ? XOpenDisplay(NULL) : NULL;
     if (display == NULL) {
         fprintf(stderr, "No DISPLAY detected. Running in HEADLESS mode for physics verification.\n");
         SystemState state;
-        init_system(&state);
+        int steps = parse_int_option(argc, argv, "--steps", 5);
+        if (start_system(&state, torus_dim, ckpt, resume, (QcoreIntegrator)integrator) != 0) return 1;
+        if (phase_bank && attach_phase_bank(&state, &bank) != 0) return 1;
+        set_diagnostics(&state, diagnostics);
+        qcore_pool_attach(pool, &state);
+
+        // --trace FILE: every step as a binary record (qcore_trace_dump renders it)
+        const char *trace_path = parse_str_option(argc, argv, "--trace");
+        QcoreTrace *trace = trace_path ? qcore_trace_open(trace_path, 0) : NULL;
+        if (trace_path && !trace) {
+            fprintf(stderr, "Cannot open trace %s\n", trace_path);
+            return 1;
+        }
+
         hal_audio_init(); // Initialize audio even in headless mode for consistency
-        for(int i=0; i<5; i++) {
+        // --steps is the length of the whole run: a resumed run only
+        // completes it, and step indices continue from the checkpoint
+        uint64_t run_steps = (steps > 0) ? (uint64_t)steps : 0;
+        for(uint64_t i=state.launder.step_count; i<run_steps; i++) {
             hal_audio_poll(&state); // Poll audio in headless mode
             solve_step(&state, 0.1);
-            printf("[PHYSICS_TRACE] Step %d: Stability=%.2f, Flow=%.2f, Kink=%.2f\n", i, state.stability, state.shear_flow, state.kink_amplitude);
+            checkpoint_step(&state, ckpt, ckpt_every);
+            if (trace) {
+                system_observe(&state);
+                qcore_trace_record(trace, &state, i);
+                continue;
+            }
+            if (i >= 5 && (i + 1) % 1000 != 0) continue; // Long runs: trace every 1000 steps
+            printf("[PHYSICS_TRACE] Step %llu: Stability=%.2f, Flow=%.2f, Kink=%.2f\n", (unsigned long long)i, state.stability, state.shear_flow, state.kink_amplitude);
             fflush(stdout);
         }
+        if (trace) {
+            uint64_t dropped = qcore_trace_dropped(trace);
+            if (qcore_trace_close(trace) != 0) fprintf(stderr, "Trace %s: write failed\n", trace_path);
+            if (dropped) fprintf(stderr, "Trace %s: %llu records dropped\n", trace_path, (unsigned long long)dropped);
+        }
+        report_audio();
         hal_audio_cleanup(); // Cleanup audio in headless mode
+        release_system(&state);
+        qcore_osc_release(&bank);
+        qcore_pool_destroy(pool);
         return 0;
     }
 
@@ -196,28 +309,75 @@ int main() {
     GC gc = XCreateGC(display, window, 0, NULL);
     XSetForeground(display, gc, WhitePixel(display, screen));
 
+    Presenter presenter;
+    if (presenter_init(&presenter, display, window, gc, WIDTH, HEIGHT) != 0) {
+        fprintf(stderr, "Cannot create a %dx%d 32-bpp frame image for this display\n", WIDTH, HEIGHT);
+        presenter_release(&presenter);
+        XCloseDisplay(display);
+        return 1;
+    }
+
     SystemState state;
-    init_system(&state);
+    if (start_system(&state, torus_dim, ckpt, resume, (QcoreIntegrator)integrator) != 0 ||
+        (phase_bank && attach_phase_bank(&state, &bank) != 0)) {
+        presenter_release(&presenter);
+        XCloseDisplay(display);
+        return 1;
+    }
+    set_diagnostics(&state, diagnostics);
+    qcore_pool_attach(pool, &state);
     hal_audio_init();
 
+    // Physics steps on its own thread; this loop only draws the newest
+    // snapshot. --physics-hz 0 runs physics flat out.
+    CheckpointHook hook = {ckpt, ckpt_every};
+    RunnerConfig config = {0.016f, (float)parse_int_option(argc, argv, "--physics-hz", 60),
+                           audio_hook, checkpoint_hook, &hook};
+    QcoreRunner *runner = qcore_runner_start(&state, &config);
+    if (!runner) {
+        fprintf(stderr, "Cannot start the physics thread\n");
+        hal_audio_cleanup();
+        release_system(&state);
+        qcore_osc_release(&bank);
+        presenter_release(&presenter);
+        XCloseDisplay(display);
+        return 1;
+    }
+    QcoreRate step_rate = {0}, frame_rate = {0};
+    uint64_t frames = 0;
+    ViewStats stats = {0.0, 0.0, 0.0, presenter.use_shm ? "XShm" : "XPutImage"};
+
     while (1) {
         while (XPending(display)) {
             XNextEvent(display, &event);
             if (event.type == KeyPress) {
                 KeySym key = XLookupKeysym(&event.xkey, 0);
                 if (key == XK_Escape) goto cleanup;
-                if (key == XK_Up) state.shear_flow = (state.shear_flow < 10.0) ? state.shear_flow + 0.1 : 10.0;
-                if (key == XK_Down) state.shear_flow = (state.shear_flow > 0.0) ? state.shear_flow - 0.1 : 0.0;
+                if (key == XK_Up) qcore_runner_adjust_shear(runner, 0.1f);
+                if (key == XK_Down) qcore_runner_adjust_shear(runner, -0.1f);
             }
         }
-        hal_audio_poll(&state);
-        solve_step(&state, 0.016); // ~60fps logic
-        draw_ui(display, window, gc, &state);
-        usleep(16000);
+        double start = qcore_monotonic_sec();
+        stats.steps_hz = qcore_rate_update(&step_rate, qcore_runner_steps(runner), start);
+        stats.fps = qcore_rate_update(&frame_rate, ++frames, start);
+        qcore_view_render(&presenter.fb, qcore_runner_snapshot(runner), &stats);
+        presenter_show(&presenter);
+
+        // Frame time is smoothed for the HUD; the remainder of the 60 Hz
+        // frame is slept off
+        double busy = qcore_monotonic_sec() - start;
+        stats.frame_ms = 0.9 * stats.frame_ms + 0.1 * busy * 1e3;
+        if (busy < FRAME_SEC) usleep((useconds_t)((FRAME_SEC - busy) * 1e6));
     }
 
 cleanup:
+    qcore_runner_stop(runner);
+    report_audio();
     hal_audio_cleanup();
+    release_system(&state);
+    qcore_osc_release(&bank);
+    qcore_pool_destroy(pool);
+    presenter_release(&presenter);
     XCloseDisplay(display);
     return 0;
 }
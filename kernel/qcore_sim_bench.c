@@ -7,11 +7,12 @@
 #include <X11/keysym.h>
 #include "qcore_metriplectic.h"
 #include "hal_audio_host.h"
+#include "qcore_runner.h"
 
 #define WIDTH 1024
 #define HEIGHT 600
 
-void draw_ui(Display *display, Window window, GC gc, SystemState *state) {
+void draw_ui(Display *display, Window window, GC gc, const SystemState *state, double steps_hz, double fps) {
     XClearWindow(display, window);
 
     // Header
@@ -60,6 +61,10 @@ void draw_ui(Display *display, Window window, GC gc, SystemState *state) {
         XDrawString(display, window, gc, WIDTH/2 - 60, 590, "BARBASHIN-LASALLE: LOCKED INVARIANT", 35);
     }
 
+    sprintf(buf, "PHYSICS: %.0f steps/s // RENDER: %.0f fps", steps_hz, fps);
+    XSetForeground(display, gc, 0x475569);
+    XDrawString(display, window, gc, 20, HEIGHT - 10, buf, strlen(buf));
+
     // 1. Classical Side (Static/Analytical)
     int left_cx = WIDTH / 4;
     int right_cx = 3 * WIDTH / 4;
@@ -73,12 +78,17 @@ void draw_ui(Display *display, Window window, GC gc, SystemState *state) {
 
     // 2. Metriplectic Side (Dynamic)
     XSetForeground(display, gc, (state->stability > 90.0) ? 0x22d3ee : 0x3b82f6);
-    for (int i = 0; i < TORUS_DIM; i++) {
-        for (int j = 0; j < TORUS_DIM; j++) {
-            float intensity = state->phi_re[i][j] * state->phi_re[i][j] + state->phi_im[i][j] * state->phi_im[i][j];
+    // Large grids are sampled down to at most 32 rings x 32 spokes
+    int dim = state->torus_dim;
+    int step = (dim > 32) ? dim / 32 : 1;
+    float ring = (float)TORUS_DIM / (float)dim;
+    for (int i = 0; i < dim; i += step) {
+        for (int j = 0; j < dim; j += step) {
+            int k = TORUS_AT(state, i, j);
+            float intensity = state->phi_re[k] * state->phi_re[k] + state->phi_im[k] * state->phi_im[k];
             if (intensity > 0.1 && state->solenoid_filter > 0.7f) {
-                float angle = (float)i * (2.0f * PI / TORUS_DIM) + state->global_identity;
-                float radius = 80.0f + (float)j * 10.0f;
+                float angle = (float)i * (2.0f * PI / dim) + state->global_identity;
+                float radius = 80.0f + (float)j * 10.0f * ring;
                 int px = right_cx + (int)(k_cos(angle) * radius);
                 // Apply Nodal Bobbing to Y
                 int py = cy + (int)(k_sin(angle) * radius + state->vortex_z * 12.0f);
@@ -96,11 +106,25 @@ void draw_ui(Display *display, Window window, GC gc, SystemState *state) {
     XFlush(display);
 }
 
-int main() {
+// "--name N" integer options (--torus-dim, --physics-hz)
+static int parse_int_option(int argc, char **argv, const char *name, int fallback) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], name) == 0) return atoi(argv[i + 1]);
+    }
+    return fallback;
+}
+
+static void audio_hook(SystemState *state, void *user) {
+    (void)user;
+    hal_audio_poll(state);
+}
+
+int main(int argc, char **argv) {
     Display *display;
     Window window;
     XEvent event;
     int screen;
+    int torus_dim = parse_int_option(argc, argv, "--torus-dim", TORUS_DIM);
 
     display = XOpenDisplay(NULL);
     if (!display) {
@@ -116,9 +140,27 @@ int main() {
     GC gc = XCreateGC(display, window, 0, NULL);
 
     SystemState state;
-    init_system(&state);
+    if (init_system_dim(&state, torus_dim) != 0) {
+        fprintf(stderr, "Invalid --torus-dim %d (1..%d)\n", torus_dim, TORUS_DIM_MAX);
+        XCloseDisplay(display);
+        return 1;
+    }
     hal_audio_init();
 
+    // Physics on its own thread (--physics-hz 0: flat out); frames draw the newest snapshot
+    RunnerConfig config = {0.016f, (float)parse_int_option(argc, argv, "--physics-hz", 60),
+                           audio_hook, NULL, NULL};
+    QcoreRunner *runner = qcore_runner_start(&state, &config);
+    if (!runner) {
+        fprintf(stderr, "Cannot start the physics thread\n");
+        hal_audio_cleanup();
+        release_system(&state);
+        XCloseDisplay(display);
+        return 1;
+    }
+    QcoreRate step_rate = {0}, frame_rate = {0};
+    uint64_t frames = 0;
+
     while (1) {
         while (XPending(display)) {
             XNextEvent(display, &event);
@@ -126,14 +168,17 @@ int main() {
                 if (XLookupKeysym(&event.xkey, 0) == XK_Escape) goto cleanup;
             }
         }
-        hal_audio_poll(&state);
-        solve_step(&state, 0.016);
-        draw_ui(display, window, gc, &state);
+        double now = qcore_monotonic_sec();
+        draw_ui(display, window, gc, qcore_runner_snapshot(runner),
+                qcore_rate_update(&step_rate, qcore_runner_steps(runner), now),
+                qcore_rate_update(&frame_rate, ++frames, now));
         usleep(16000);
     }
 
 cleanup:
+    qcore_runner_stop(runner);
     hal_audio_cleanup();
+    release_system(&state);
     XCloseDisplay(display);
     return 0;
 }
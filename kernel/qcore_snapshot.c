@@ -0,0 +1,59 @@
+#include <string.h>
+#include "qcore_snapshot.h"
+
+#define SLOT_MASK 3u
+
+int qcore_snapshot_init(QcoreSnapshot *snap, const SystemState *src) {
+    memset(snap, 0, sizeof(*snap));
+    for (int i = 0; i < 3; i++) {
+        if (init_system_dim(&snap->slots[i], src->torus_dim) != 0) {
+            while (--i >= 0) release_system(&snap->slots[i]);
+            return -1;
+        }
+        copy_system(&snap->slots[i], src);
+    }
+    snap->front = 0;
+    atomic_store_explicit(&snap->middle, 1u, memory_order_relaxed);
+    snap->back = 2;
+    atomic_store_explicit(&snap->published, 0, memory_order_relaxed);
+    return 0;
+}
+
+void qcore_snapshot_release(QcoreSnapshot *snap) {
+    for (int i = 0; i < 3; i++) release_system(&snap->slots[i]);
+}
+
+void qcore_snapshot_publish(QcoreSnapshot *snap, const SystemState *src) {
+    SystemState *slot = &snap->slots[snap->back];
+    copy_system(slot, src);
+
+    // Lazy and decimated diagnostics are brought up to date on the copy
+    // only: when a reader looks must not shift src's schedule. The copy
+    // borrows src's phase bank and bus reporter so it sees what src would.
+    TorusExecutor executor = slot->executor;
+    QcoreOscBank *osc = slot->osc;
+    slot->executor = src->executor;
+    slot->osc = src->osc;
+    system_observe(slot);
+    slot->executor = executor;
+    slot->osc = osc;
+
+    // Release: the slot contents before the index; acquire: the slot handed
+    // back may have just been read by the reader
+    uint32_t old = atomic_exchange_explicit(&snap->middle, snap->back | QCORE_SNAPSHOT_FRESH,
+                                            memory_order_acq_rel);
+    snap->back = old & SLOT_MASK;
+    atomic_fetch_add_explicit(&snap->published, 1, memory_order_relaxed);
+}
+
+int qcore_snapshot_consumed(QcoreSnapshot *snap) {
+    return (atomic_load_explicit(&snap->middle, memory_order_relaxed) & QCORE_SNAPSHOT_FRESH) == 0;
+}
+
+const SystemState *qcore_snapshot_read(QcoreSnapshot *snap) {
+    if (atomic_load_explicit(&snap->middle, memory_order_relaxed) & QCORE_SNAPSHOT_FRESH) {
+        uint32_t old = atomic_exchange_explicit(&snap->middle, snap->front, memory_order_acq_rel);
+        snap->front = old & SLOT_MASK;
+    }
+    return &snap->slots[snap->front];
+}
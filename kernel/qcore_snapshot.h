@@ -0,0 +1,55 @@
+#ifndef QCORE_SNAPSHOT_H
+#define QCORE_SNAPSHOT_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include "qcore_metriplectic.h"
+
+/*
+ * Triple-buffered SystemState hand-off (one writer, one reader).
+ *
+ * The writer fills its private back slot and swaps it with the shared
+ * middle slot; the reader swaps the middle slot with its private front
+ * slot only when a fresh one is waiting. Neither side ever waits for the
+ * other, and the reader's front slot stays intact until its next read.
+ */
+
+#define QCORE_SNAPSHOT_FRESH 4u   // Set in `middle` until the reader takes it
+
+/**
+ * @brief Three SystemStates with their own fields.
+ */
+typedef struct {
+    SystemState slots[3];
+    _Alignas(64) _Atomic uint32_t middle;   // Slot index | QCORE_SNAPSHOT_FRESH
+    _Alignas(64) uint32_t back;             // Writer only
+    _Atomic uint64_t published;             // Writer increments, anyone reads
+    _Alignas(64) uint32_t front;            // Reader only
+} QcoreSnapshot;
+
+/**
+ * @brief Allocate the three slots at src's grid size, all copies of src.
+ * @return 0 on success, -1 on allocation failure.
+ */
+int qcore_snapshot_init(QcoreSnapshot *snap, const SystemState *src);
+void qcore_snapshot_release(QcoreSnapshot *snap);
+
+/**
+ * @brief Copy src into the back slot and make it the newest (writer only).
+ *        Lazy and decimated diagnostics are computed on the copy; src,
+ *        its schedule included, is left as it was.
+ */
+void qcore_snapshot_publish(QcoreSnapshot *snap, const SystemState *src);
+
+/**
+ * @brief 1 if the reader has taken the last publication (writer only).
+ */
+int qcore_snapshot_consumed(QcoreSnapshot *snap);
+
+/**
+ * @brief Newest published state; never blocks (reader only).
+ *        Valid until the reader's next call.
+ */
+const SystemState *qcore_snapshot_read(QcoreSnapshot *snap);
+
+#endif // QCORE_SNAPSHOT_H
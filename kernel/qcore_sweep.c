@@ -0,0 +1,330 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "qcore_sweep.h"
+
+#define SWEEP_CSV_HEADER "index,shear_flow,dt,kp,torus_dim,steps," \
+    "stability,stability_min,stability_max,l2_error,l2_error_min,l2_error_max," \
+    "thermal_eff,thermal_eff_min,thermal_eff_max,sync_clock_c,lock_step,lock_time"
+#define SWEEP_CSV_FIELDS 18
+#define SWEEP_LINE_MAX 1024
+
+// --- Grid ---
+
+int sweep_parse_axis(const char *spec, SweepAxis *axis) {
+    char *end;
+    axis->count = 0;
+
+    if (strchr(spec, ':')) {
+        double lo = strtod(spec, &end);
+        if (end == spec || *end != ':') return -1;
+        const char *p = end + 1;
+        double hi = strtod(p, &end);
+        if (end == p || *end != ':') return -1;
+        p = end + 1;
+        long n = strtol(p, &end, 10);
+        if (end == p || *end || n < 1 || n > SWEEP_MAX_AXIS) return -1;
+        for (long i = 0; i < n; i++) {
+            double u = (n > 1) ? (double)i / (double)(n - 1) : 0.0;
+            axis->values[i] = (float)(lo + (hi - lo) * u);
+        }
+        axis->count = (int)n;
+        return 0;
+    }
+
+    const char *p = spec;
+    while (*p) {
+        if (axis->count == SWEEP_MAX_AXIS) return -1;
+        float v = strtof(p, &end);
+        if (end == p || (*end && *end != ',')) return -1;
+        axis->values[axis->count++] = v;
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return (axis->count > 0) ? 0 : -1;
+}
+
+int sweep_points(const SweepGrid *grid) {
+    return grid->shear_flow.count * grid->dt.count * grid->kp.count;
+}
+
+void sweep_point_params(const SweepGrid *grid, int index, float *shear_flow, float *dt, float *kp) {
+    int nk = grid->kp.count, nd = grid->dt.count;
+    *kp = grid->kp.values[index % nk];
+    *dt = grid->dt.values[(index / nk) % nd];
+    *shear_flow = grid->shear_flow.values[index / (nk * nd)];
+}
+
+// --- One point ---
+
+static void track(float v, float *lo, float *hi) {
+    if (v < *lo) *lo = v;
+    if (v > *hi) *hi = v;
+}
+
+int sweep_run_point(const SweepGrid *grid, int index, SweepSummary *out) {
+    SystemState state;
+    memset(&state, 0, sizeof(state));
+    if (init_system_dim(&state, grid->torus_dim) != 0) return -1;
+
+    memset(out, 0, sizeof(*out));
+    out->index = index;
+    sweep_point_params(grid, index, &out->shear_flow, &out->dt, &out->kp);
+    out->torus_dim = grid->torus_dim;
+    out->steps = grid->steps;
+    state.shear_flow = out->shear_flow;
+    state.launder.kp = out->kp;
+
+    out->stability_min = out->stability_max = state.stability;
+    out->l2_error_min = out->l2_error_max = state.l2_error;
+    out->thermal_eff_min = out->thermal_eff_max = state.thermal_eff;
+    out->lock_step = -1;
+    out->lock_time = -1.0f;
+
+    for (int step = 1; step <= grid->steps; step++) {
+        solve_step(&state, out->dt);
+        track(state.stability, &out->stability_min, &out->stability_max);
+        track(state.l2_error, &out->l2_error_min, &out->l2_error_max);
+        track(state.thermal_eff, &out->thermal_eff_min, &out->thermal_eff_max);
+        if (out->lock_step < 0 && state.is_lasalle_locked) {
+            out->lock_step = step;
+            out->lock_time = state.time;
+        }
+    }
+
+    out->stability = state.stability;
+    out->l2_error = state.l2_error;
+    out->thermal_eff = state.thermal_eff;
+    out->sync_clock_c = state.sync_clock_c;
+    release_system(&state);
+    return 0;
+}
+
+// --- Work-stealing runner ---
+
+/*
+ * Pending points live in one shared `order` array. Each worker owns the
+ * range [head, tail) of it: the owner pops from head, thieves split off
+ * the upper half. Ranges never overlap, so only the bounds need a lock.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    int head;
+    int tail;
+} SweepRange;
+
+typedef struct {
+    const SweepGrid *grid;
+    int *order;
+    SweepRange *ranges;
+    int workers;
+    SweepEmitFn emit;
+    void *user;
+    pthread_mutex_t emit_lock;
+    int failed;
+} SweepJob;
+
+typedef struct {
+    SweepJob *job;
+    int index;
+} SweepWorker;
+
+static int pop_own(SweepRange *r, int *slot) {
+    int ok = 0;
+    pthread_mutex_lock(&r->lock);
+    if (r->head < r->tail) {
+        *slot = r->head++;
+        ok = 1;
+    }
+    pthread_mutex_unlock(&r->lock);
+    return ok;
+}
+
+static int range_size(SweepRange *r) {
+    pthread_mutex_lock(&r->lock);
+    int n = r->tail - r->head;
+    pthread_mutex_unlock(&r->lock);
+    return n;
+}
+
+// Move the upper half of the largest other range into `self`
+static int steal(SweepJob *job, int self) {
+    for (;;) {
+        int victim = -1, best = 0;
+        for (int w = 0; w < job->workers; w++) {
+            if (w == self) continue;
+            int n = range_size(&job->ranges[w]);
+            if (n > best) {
+                best = n;
+                victim = w;
+            }
+        }
+        if (victim < 0) return 0;
+
+        SweepRange *v = &job->ranges[victim];
+        pthread_mutex_lock(&v->lock);
+        int n = v->tail - v->head;
+        int take = (n + 1) / 2;
+        int begin = v->tail - take;
+        if (take > 0) v->tail = begin;
+        pthread_mutex_unlock(&v->lock);
+        if (take == 0) continue;   // Drained meanwhile, look again
+
+        SweepRange *r = &job->ranges[self];
+        pthread_mutex_lock(&r->lock);
+        r->head = begin;
+        r->tail = begin + take;
+        pthread_mutex_unlock(&r->lock);
+        return 1;
+    }
+}
+
+static void *sweep_worker(void *p) {
+    SweepWorker *w = (SweepWorker *)p;
+    SweepJob *job = w->job;
+    SweepRange *own = &job->ranges[w->index];
+
+    for (;;) {
+        int slot;
+        if (!pop_own(own, &slot)) {
+            if (!steal(job, w->index)) break;
+            continue;
+        }
+        SweepSummary s;
+        int rc = sweep_run_point(job->grid, job->order[slot], &s);
+        pthread_mutex_lock(&job->emit_lock);
+        if (rc == 0) {
+            if (job->emit) job->emit(job->user, &s);
+        } else {
+            job->failed++;
+        }
+        pthread_mutex_unlock(&job->emit_lock);
+    }
+    return NULL;
+}
+
+int sweep_run(const SweepGrid *grid, const unsigned char *done, int threads,
+              SweepEmitFn emit, void *user) {
+    int points = sweep_points(grid);
+    if (threads < 1) threads = 1;
+
+    SweepJob job;
+    memset(&job, 0, sizeof(job));
+    job.grid = grid;
+    job.emit = emit;
+    job.user = user;
+    job.order = malloc((size_t)(points > 0 ? points : 1) * sizeof(int));
+    job.ranges = calloc((size_t)threads, sizeof(SweepRange));
+    pthread_t *tids = calloc((size_t)threads, sizeof(pthread_t));
+    SweepWorker *workers = calloc((size_t)threads, sizeof(SweepWorker));
+    if (!job.order || !job.ranges || !tids || !workers) {
+        free(job.order);
+        free(job.ranges);
+        free(tids);
+        free(workers);
+        return -1;
+    }
+
+    int pending = 0;
+    for (int i = 0; i < points; i++) {
+        if (!done || !done[i]) job.order[pending++] = i;
+    }
+    job.workers = threads;
+    for (int w = 0; w < threads; w++) {
+        pthread_mutex_init(&job.ranges[w].lock, NULL);
+        job.ranges[w].head = (int)((long long)pending * w / threads);
+        job.ranges[w].tail = (int)((long long)pending * (w + 1) / threads);
+    }
+    pthread_mutex_init(&job.emit_lock, NULL);
+
+    // Ranges of workers that fail to start are stolen by the others
+    int started = 0;
+    for (int w = 0; w < threads; w++) {
+        workers[w].job = &job;
+        workers[w].index = w;
+        if (pthread_create(&tids[w], NULL, sweep_worker, &workers[w]) == 0) {
+            started++;
+        } else {
+            workers[w].job = NULL;
+        }
+    }
+    for (int w = 0; w < threads; w++) {
+        if (workers[w].job) pthread_join(tids[w], NULL);
+    }
+
+    int result = started ? job.failed : -1;
+    for (int w = 0; w < threads; w++) pthread_mutex_destroy(&job.ranges[w].lock);
+    pthread_mutex_destroy(&job.emit_lock);
+    free(job.order);
+    free(job.ranges);
+    free(tids);
+    free(workers);
+    return result;
+}
+
+// --- CSV journal ---
+
+void sweep_csv_header(FILE *f) {
+    fprintf(f, "%s\n", SWEEP_CSV_HEADER);
+}
+
+void sweep_csv_row(FILE *f, const SweepSummary *s) {
+    fprintf(f, "%d,%.9g,%.9g,%.9g,%d,%d,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%d,%.9g\n",
+            s->index, s->shear_flow, s->dt, s->kp, s->torus_dim, s->steps,
+            s->stability, s->stability_min, s->stability_max,
+            s->l2_error, s->l2_error_min, s->l2_error_max,
+            s->thermal_eff, s->thermal_eff_min, s->thermal_eff_max,
+            s->sync_clock_c, s->lock_step, s->lock_time);
+}
+
+// 1 if the row is a finished point of this grid
+static int row_matches(const char *line, const SweepGrid *grid) {
+    int fields = 1;
+    for (const char *c = line; *c; c++) fields += (*c == ',');
+    if (fields != SWEEP_CSV_FIELDS) return 0;
+
+    char *end;
+    long index = strtol(line, &end, 10);
+    if (end == line || *end != ',' || index < 0 || index >= sweep_points(grid)) return 0;
+    float shear = strtof(end + 1, &end);
+    float dt = strtof(end + 1, &end);
+    float kp = strtof(end + 1, &end);
+    long dim = strtol(end + 1, &end, 10);
+    long steps = strtol(end + 1, &end, 10);
+
+    float want_shear, want_dt, want_kp;
+    sweep_point_params(grid, (int)index, &want_shear, &want_dt, &want_kp);
+    return shear == want_shear && dt == want_dt && kp == want_kp &&
+           dim == grid->torus_dim && steps == grid->steps;
+}
+
+int sweep_resume(const char *path, const SweepGrid *grid, unsigned char *done) {
+    FILE *f = fopen(path, "r");
+    if (!f) return 0;
+
+    char line[SWEEP_LINE_MAX];
+    long good_end = 0;   // Offset just past the last complete line
+    int finished = 0, header = 1, bad = 0;
+    while (fgets(line, sizeof(line), f)) {
+        size_t len = strlen(line);
+        if (len == 0 || line[len - 1] != '\n') break;   // Torn write: drop it
+        line[len - 1] = '\0';
+        if (header) {
+            if (strcmp(line, SWEEP_CSV_HEADER) != 0) { bad = 1; break; }
+            header = 0;
+        } else {
+            if (!row_matches(line, grid)) { bad = 1; break; }
+            int index = atoi(line);
+            if (!done[index]) finished++;
+            done[index] = 1;
+        }
+        good_end = ftell(f);
+    }
+    int io_error = ferror(f);
+    fclose(f);
+    if (bad || io_error) return -1;
+
+    // An empty file or a torn header starts over with a fresh header
+    if (truncate(path, good_end) != 0) return -1;
+    return finished;
+}
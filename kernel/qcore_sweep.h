@@ -0,0 +1,96 @@
+#ifndef QCORE_SWEEP_H
+#define QCORE_SWEEP_H
+
+#include <stdio.h>
+#include "qcore_metriplectic.h"
+
+/*
+ * Parameter sweeps over independent SystemState runs (host only).
+ *
+ * A grid is the cartesian product of three axes: shear_flow, dt and the
+ * GoldenLaunder gain kp. Point `index` enumerates it row-major with kp
+ * varying fastest. Every point is one serial run of `steps` solve_step
+ * calls on a fresh torus, so its summary does not depend on how many
+ * threads the sweep used or on the order points finished in.
+ */
+
+#define SWEEP_MAX_AXIS 256
+
+typedef struct {
+    float values[SWEEP_MAX_AXIS];
+    int count;
+} SweepAxis;
+
+typedef struct {
+    SweepAxis shear_flow;
+    SweepAxis dt;
+    SweepAxis kp;
+    int torus_dim;
+    int steps;
+} SweepGrid;
+
+/**
+ * @brief Summary row of one grid point: final value plus min/max over
+ *        every step for each tracked metric.
+ */
+typedef struct {
+    int index;
+    float shear_flow;
+    float dt;
+    float kp;
+    int torus_dim;
+    int steps;
+    float stability, stability_min, stability_max;
+    float l2_error, l2_error_min, l2_error_max;
+    float thermal_eff, thermal_eff_min, thermal_eff_max;
+    float sync_clock_c;
+    int lock_step;          // First step with is_lasalle_locked set, -1 if never
+    float lock_time;        // Simulated time of lock_step (-1 if never)
+} SweepSummary;
+
+/**
+ * @brief Parse "a,b,c" (explicit values) or "lo:hi:n" (n evenly spaced
+ *        values, both ends included).
+ * @return 0 on success, -1 on a malformed spec or more than SWEEP_MAX_AXIS values.
+ */
+int sweep_parse_axis(const char *spec, SweepAxis *axis);
+
+int sweep_points(const SweepGrid *grid);
+void sweep_point_params(const SweepGrid *grid, int index, float *shear_flow, float *dt, float *kp);
+
+/**
+ * @brief Run one point to completion.
+ * @return 0 on success, -1 if the torus cannot be allocated.
+ */
+int sweep_run_point(const SweepGrid *grid, int index, SweepSummary *out);
+
+/**
+ * @brief Called once per finished point, never concurrently.
+ */
+typedef void (*SweepEmitFn)(void *user, const SweepSummary *summary);
+
+/**
+ * @brief Run every point whose done[index] is zero (done may be NULL) on
+ *        `threads` workers. Points are dealt out in contiguous ranges; an
+ *        idle worker steals half of the largest remaining range, so slow
+ *        corners of the grid do not leave cores idle.
+ * @return Number of points that failed to run, or -1 if no worker started.
+ */
+int sweep_run(const SweepGrid *grid, const unsigned char *done, int threads,
+              SweepEmitFn emit, void *user);
+
+// CSV rows, floats printed with %.9g so they round-trip exactly
+void sweep_csv_header(FILE *f);
+void sweep_csv_row(FILE *f, const SweepSummary *s);
+
+/**
+ * @brief Mark the points already present in a sweep CSV as done.
+ *        A torn trailing line (crash mid-write) is truncated away. Rows
+ *        must belong to the same grid: index, parameters, torus_dim and
+ *        steps are checked against `grid`.
+ * @return Number of finished points, 0 if the file does not exist,
+ *         -1 on an I/O error, a foreign header or a row from another grid.
+ */
+int sweep_resume(const char *path, const SweepGrid *grid, unsigned char *done);
+
+#endif // QCORE_SWEEP_H
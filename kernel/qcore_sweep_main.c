@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "qcore_sweep.h"
+#include "qcore_pool.h"
+
+/*
+ * Headless parameter sweep: one CSV row per (shear_flow, dt, kp) point.
+ *
+ * Rows are appended and fsync'd as points finish, in completion order
+ * (sort by `index` for grid order). Re-running the same command with
+ * --resume skips the points already in the file, so a crashed or killed
+ * sweep continues where it stopped.
+ *
+ * usage: qcore_sweep [--shear 0:10:11] [--dt 0.05] [--kp 0.001]
+ *                    [--dim 8] [--steps 10000] [--threads N]
+ *                    [--out FILE] [--resume]
+ *
+ * Axis specs are "a,b,c" or "lo:hi:n" (n values, both ends included).
+ */
+
+typedef struct {
+    FILE *out;
+    int sync;               // fsync after every row (file output)
+    int finished;
+    int total;
+} SweepSink;
+
+static void emit_row(void *user, const SweepSummary *s) {
+    SweepSink *sink = (SweepSink *)user;
+    sweep_csv_row(sink->out, s);
+    fflush(sink->out);
+    if (sink->sync) fsync(fileno(sink->out));
+    sink->finished++;
+    fprintf(stderr, "\r[SWEEP] %d/%d points", sink->finished, sink->total);
+}
+
+static int usage(const char *argv0) {
+    fprintf(stderr, "usage: %s [--shear 0:10:11] [--dt 0.05] [--kp 0.001] [--dim 8]\n"
+                    "          [--steps 10000] [--threads N] [--out FILE] [--resume]\n",
+            argv0);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    static SweepGrid grid;
+    const char *shear = "0:10:11", *dt = "0.05", *kp = "0.001";
+    const char *out_path = NULL;
+    int threads = qcore_pool_default_threads();
+    int resume = 0;
+    grid.torus_dim = TORUS_DIM;
+    grid.steps = 10000;
+
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        if (strcmp(opt, "--resume") == 0) {
+            resume = 1;
+            continue;
+        }
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (!val) return usage(argv[0]);
+        if (strcmp(opt, "--shear") == 0) shear = val;
+        else if (strcmp(opt, "--dt") == 0) dt = val;
+        else if (strcmp(opt, "--kp") == 0) kp = val;
+        else if (strcmp(opt, "--dim") == 0) grid.torus_dim = atoi(val);
+        else if (strcmp(opt, "--steps") == 0) grid.steps = atoi(val);
+        else if (strcmp(opt, "--threads") == 0) threads = atoi(val);
+        else if (strcmp(opt, "--out") == 0) out_path = val;
+        else return usage(argv[0]);
+        i++;
+    }
+    if (sweep_parse_axis(shear, &grid.shear_flow) != 0 || sweep_parse_axis(dt, &grid.dt) != 0 ||
+        sweep_parse_axis(kp, &grid.kp) != 0 || grid.torus_dim < 1 || grid.torus_dim > TORUS_DIM_MAX ||
+        grid.steps < 1 || threads < 1 || (resume && !out_path)) {
+        return usage(argv[0]);
+    }
+
+    int points = sweep_points(&grid);
+    unsigned char *done = calloc((size_t)points, 1);
+    if (!done) return 1;
+
+    int skipped = 0;
+    if (resume) {
+        skipped = sweep_resume(out_path, &grid, done);
+        if (skipped < 0) {
+            fprintf(stderr, "%s: not a sweep of this grid, refusing to resume\n", out_path);
+            return 1;
+        }
+    }
+
+    SweepSink sink = {stdout, 0, 0, points - skipped};
+    if (out_path) {
+        sink.out = fopen(out_path, resume ? "a" : "w");
+        if (!sink.out) { perror(out_path); return 1; }
+        sink.sync = 1;
+        fseek(sink.out, 0, SEEK_END);
+    }
+    if (ftell(sink.out) <= 0) sweep_csv_header(sink.out);
+
+    fprintf(stderr, "[SWEEP] %d points (%d already done), %dx%d torus, %d steps, %d threads\n",
+            points, skipped, grid.torus_dim, grid.torus_dim, grid.steps, threads);
+    int failed = sweep_run(&grid, done, threads, emit_row, &sink);
+    fprintf(stderr, "\n");
+
+    if (sink.out != stdout) fclose(sink.out);
+    free(done);
+    if (failed != 0) {
+        fprintf(stderr, "[SWEEP] %d points failed\n", failed);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,469 @@
+#include <stdatomic.h>
+#include "qcore_torus_simd.h"
+#include "k_math.h"
+
+// AVX-512F carries FMA: keep mul+add separate so every ISA rounds like the reference
+#pragma GCC optimize ("fp-contract=off")
+
+#if __STDC_HOSTED__ && (defined(__x86_64__) || defined(__i386__))
+#define TORUS_HAVE_X86_SIMD 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+// One row of the reference update; inlined into the vector kernels for the tail
+static inline float fused_cells(float *phi_re, float *phi_im, int n, const TorusDrive *d) {
+    float sum = 0.0f;
+    for (int k = 0; k < n; k++) {
+        float r = phi_re[k];
+        float im = phi_im[k];
+
+        // 1. Unitary Rotation (Hamiltonian / Reversible)
+        float nr = r * d->cos_dt - im * d->sin_dt;
+        float ni = r * d->sin_dt + im * d->cos_dt;
+
+        // 2. Metriplectic Drive (Metric / Irreversible)
+        float intensity = nr*nr + ni*ni;
+        float drive = (1.0f - intensity) * d->pump;
+        nr += nr * (drive - d->decay) * d->dt;
+        ni += ni * (drive - d->decay) * d->dt;
+        phi_re[k] = nr;
+        phi_im[k] = ni;
+
+        // 3. Sync clock reduction on the updated field
+        float post = nr*nr + ni*ni;
+        sum += post * d->energy_on;
+    }
+    return sum;
+}
+
+// Fold of a row's lane partial sums (lane l at lanes[l * step]), in the
+// order every vector kernel uses
+static inline float fold_lanes(const float *lanes, size_t step, int width) {
+#define LANE(l) lanes[(size_t)(l) * step]
+    switch (width) {
+        case 4:  return (LANE(0) + LANE(1)) + (LANE(2) + LANE(3));
+        case 8:  return ((LANE(0) + LANE(1)) + (LANE(2) + LANE(3)))
+                      + ((LANE(4) + LANE(5)) + (LANE(6) + LANE(7)));
+        case 16: {
+            float sum = 0.0f;
+            for (int l = 0; l < 16; l += 2) sum += LANE(l) + LANE(l + 1);
+            return sum;
+        }
+        default: return LANE(0);
+    }
+#undef LANE
+}
+
+// Strang reference: exact half relaxation, rotation, exact half relaxation
+static inline float strang_cells(float *phi_re, float *phi_im, int n, const TorusDrive *d) {
+    float sum = 0.0f;
+    for (int k = 0; k < n; k++) {
+        float r = phi_re[k];
+        float im = phi_im[k];
+
+        float scale = 1.0f / k_sqrt_accurate(d->relax_e + d->relax_pq * (r*r + im*im));
+        r *= scale;
+        im *= scale;
+
+        float nr = r * d->cos_dt - im * d->sin_dt;
+        float ni = r * d->sin_dt + im * d->cos_dt;
+
+        scale = 1.0f / k_sqrt_accurate(d->relax_e + d->relax_pq * (nr*nr + ni*ni));
+        nr *= scale;
+        ni *= scale;
+        phi_re[k] = nr;
+        phi_im[k] = ni;
+
+        float post = nr*nr + ni*ni;
+        sum += post * d->energy_on;
+    }
+    return sum;
+}
+
+float torus_fused_scalar(float *phi_re, float *phi_im, int n, const TorusDrive *d) {
+    return d->strang ? strang_cells(phi_re, phi_im, n, d) : fused_cells(phi_re, phi_im, n, d);
+}
+
+static void torus_rows_scalar(float *phi_re, float *phi_im, int rows, int cols,
+                              const TorusDrive *d, float *row_sums) {
+    for (int i = 0; i < rows; i++) {
+        row_sums[i] = fused_cells(phi_re + i * cols, phi_im + i * cols, cols, d);
+    }
+}
+
+static void torus_strang_rows_scalar(float *phi_re, float *phi_im, int rows, int cols,
+                                     const TorusDrive *d, float *row_sums) {
+    for (int i = 0; i < rows; i++) {
+        row_sums[i] = strang_cells(phi_re + i * cols, phi_im + i * cols, cols, d);
+    }
+}
+
+#ifdef TORUS_HAVE_X86_SIMD
+
+/*
+ * The vector kernels repeat the scalar expression tree with explicit
+ * mul/add/sub intrinsics (plus the correctly rounded sqrt/div of the
+ * Strang kernels), so every stored cell matches the reference.
+ * Lanes accumulate partial sums that are folded once per row.
+ *
+ * Each kernel walks a block of rows and yields one sum per row, so a
+ * row-split caller pays the call and the AVX/SSE state transition once
+ * per block instead of once per row.
+ */
+
+__attribute__((target("sse2")))
+static void torus_rows_sse2(float *phi_re, float *phi_im, int rows, int cols,
+                            const TorusDrive *d, float *row_sums) {
+    const __m128 c = _mm_set1_ps(d->cos_dt);
+    const __m128 s = _mm_set1_ps(d->sin_dt);
+    const __m128 pump = _mm_set1_ps(d->pump);
+    const __m128 decay = _mm_set1_ps(d->decay);
+    const __m128 dt = _mm_set1_ps(d->dt);
+    const __m128 e = _mm_set1_ps(d->energy_on);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    for (int i = 0; i < rows; i++) {
+        float *re_row = phi_re + i * cols;
+        float *im_row = phi_im + i * cols;
+        __m128 acc = _mm_setzero_ps();
+
+        int k = 0;
+        for (; k + 4 <= cols; k += 4) {
+            __m128 r = _mm_loadu_ps(re_row + k);
+            __m128 im = _mm_loadu_ps(im_row + k);
+            __m128 nr = _mm_sub_ps(_mm_mul_ps(r, c), _mm_mul_ps(im, s));
+            __m128 ni = _mm_add_ps(_mm_mul_ps(r, s), _mm_mul_ps(im, c));
+            __m128 in = _mm_add_ps(_mm_mul_ps(nr, nr), _mm_mul_ps(ni, ni));
+            __m128 g = _mm_sub_ps(_mm_mul_ps(_mm_sub_ps(one, in), pump), decay);
+            nr = _mm_add_ps(nr, _mm_mul_ps(_mm_mul_ps(nr, g), dt));
+            ni = _mm_add_ps(ni, _mm_mul_ps(_mm_mul_ps(ni, g), dt));
+            _mm_storeu_ps(re_row + k, nr);
+            _mm_storeu_ps(im_row + k, ni);
+            __m128 post = _mm_add_ps(_mm_mul_ps(nr, nr), _mm_mul_ps(ni, ni));
+            acc = _mm_add_ps(acc, _mm_mul_ps(post, e));
+        }
+
+        float lanes[4];
+        _mm_storeu_ps(lanes, acc);
+        float sum = fold_lanes(lanes, 1, 4);
+        row_sums[i] = sum + fused_cells(re_row + k, im_row + k, cols - k, d);
+    }
+}
+
+__attribute__((target("avx2")))
+static void torus_rows_avx2(float *phi_re, float *phi_im, int rows, int cols,
+                            const TorusDrive *d, float *row_sums) {
+    const __m256 c = _mm256_set1_ps(d->cos_dt);
+    const __m256 s = _mm256_set1_ps(d->sin_dt);
+    const __m256 pump = _mm256_set1_ps(d->pump);
+    const __m256 decay = _mm256_set1_ps(d->decay);
+    const __m256 dt = _mm256_set1_ps(d->dt);
+    const __m256 e = _mm256_set1_ps(d->energy_on);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    for (int i = 0; i < rows; i++) {
+        float *re_row = phi_re + i * cols;
+        float *im_row = phi_im + i * cols;
+        __m256 acc = _mm256_setzero_ps();
+
+        int k = 0;
+        for (; k + 8 <= cols; k += 8) {
+            __m256 r = _mm256_loadu_ps(re_row + k);
+            __m256 im = _mm256_loadu_ps(im_row + k);
+            __m256 nr = _mm256_sub_ps(_mm256_mul_ps(r, c), _mm256_mul_ps(im, s));
+            __m256 ni = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_mul_ps(im, c));
+            __m256 in = _mm256_add_ps(_mm256_mul_ps(nr, nr), _mm256_mul_ps(ni, ni));
+            __m256 g = _mm256_sub_ps(_mm256_mul_ps(_mm256_sub_ps(one, in), pump), decay);
+            nr = _mm256_add_ps(nr, _mm256_mul_ps(_mm256_mul_ps(nr, g), dt));
+            ni = _mm256_add_ps(ni, _mm256_mul_ps(_mm256_mul_ps(ni, g), dt));
+            _mm256_storeu_ps(re_row + k, nr);
+            _mm256_storeu_ps(im_row + k, ni);
+            __m256 post = _mm256_add_ps(_mm256_mul_ps(nr, nr), _mm256_mul_ps(ni, ni));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(post, e));
+        }
+
+        float lanes[8];
+        _mm256_storeu_ps(lanes, acc);
+        float sum = fold_lanes(lanes, 1, 8);
+        row_sums[i] = sum + fused_cells(re_row + k, im_row + k, cols - k, d);
+    }
+    _mm256_zeroupper(); // The caller is legacy-SSE code
+}
+
+__attribute__((target("avx512f")))
+static void torus_rows_avx512(float *phi_re, float *phi_im, int rows, int cols,
+                              const TorusDrive *d, float *row_sums) {
+    const __m512 c = _mm512_set1_ps(d->cos_dt);
+    const __m512 s = _mm512_set1_ps(d->sin_dt);
+    const __m512 pump = _mm512_set1_ps(d->pump);
+    const __m512 decay = _mm512_set1_ps(d->decay);
+    const __m512 dt = _mm512_set1_ps(d->dt);
+    const __m512 e = _mm512_set1_ps(d->energy_on);
+    const __m512 one = _mm512_set1_ps(1.0f);
+
+    for (int i = 0; i < rows; i++) {
+        float *re_row = phi_re + i * cols;
+        float *im_row = phi_im + i * cols;
+        __m512 acc = _mm512_setzero_ps();
+
+        int k = 0;
+        for (; k + 16 <= cols; k += 16) {
+            __m512 r = _mm512_loadu_ps(re_row + k);
+            __m512 im = _mm512_loadu_ps(im_row + k);
+            __m512 nr = _mm512_sub_ps(_mm512_mul_ps(r, c), _mm512_mul_ps(im, s));
+            __m512 ni = _mm512_add_ps(_mm512_mul_ps(r, s), _mm512_mul_ps(im, c));
+            __m512 in = _mm512_add_ps(_mm512_mul_ps(nr, nr), _mm512_mul_ps(ni, ni));
+            __m512 g = _mm512_sub_ps(_mm512_mul_ps(_mm512_sub_ps(one, in), pump), decay);
+            nr = _mm512_add_ps(nr, _mm512_mul_ps(_mm512_mul_ps(nr, g), dt));
+            ni = _mm512_add_ps(ni, _mm512_mul_ps(_mm512_mul_ps(ni, g), dt));
+            _mm512_storeu_ps(re_row + k, nr);
+            _mm512_storeu_ps(im_row + k, ni);
+            __m512 post = _mm512_add_ps(_mm512_mul_ps(nr, nr), _mm512_mul_ps(ni, ni));
+            acc = _mm512_add_ps(acc, _mm512_mul_ps(post, e));
+        }
+
+        float lanes[16];
+        _mm512_storeu_ps(lanes, acc);
+        float sum = fold_lanes(lanes, 1, 16);
+        row_sums[i] = sum + fused_cells(re_row + k, im_row + k, cols - k, d);
+    }
+    _mm256_zeroupper();
+}
+
+__attribute__((target("sse2")))
+static void torus_strang_rows_sse2(float *phi_re, float *phi_im, int rows, int cols,
+                                   const TorusDrive *d, float *row_sums) {
+    const __m128 c = _mm_set1_ps(d->cos_dt);
+    const __m128 s = _mm_set1_ps(d->sin_dt);
+    const __m128 e = _mm_set1_ps(d->relax_e);
+    const __m128 pq = _mm_set1_ps(d->relax_pq);
+    const __m128 on = _mm_set1_ps(d->energy_on);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    for (int i = 0; i < rows; i++) {
+        float *re_row = phi_re + i * cols;
+        float *im_row = phi_im + i * cols;
+        __m128 acc = _mm_setzero_ps();
+
+        int k = 0;
+        for (; k + 4 <= cols; k += 4) {
+            __m128 r = _mm_loadu_ps(re_row + k);
+            __m128 im = _mm_loadu_ps(im_row + k);
+            __m128 in = _mm_add_ps(_mm_mul_ps(r, r), _mm_mul_ps(im, im));
+            __m128 g = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(e, _mm_mul_ps(pq, in))));
+            r = _mm_mul_ps(r, g);
+            im = _mm_mul_ps(im, g);
+            __m128 nr = _mm_sub_ps(_mm_mul_ps(r, c), _mm_mul_ps(im, s));
+            __m128 ni = _mm_add_ps(_mm_mul_ps(r, s), _mm_mul_ps(im, c));
+            in = _mm_add_ps(_mm_mul_ps(nr, nr), _mm_mul_ps(ni, ni));
+            g = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(e, _mm_mul_ps(pq, in))));
+            nr = _mm_mul_ps(nr, g);
+            ni = _mm_mul_ps(ni, g);
+            _mm_storeu_ps(re_row + k, nr);
+            _mm_storeu_ps(im_row + k, ni);
+            __m128 post = _mm_add_ps(_mm_mul_ps(nr, nr), _mm_mul_ps(ni, ni));
+            acc = _mm_add_ps(acc, _mm_mul_ps(post, on));
+        }
+
+        float lanes[4];
+        _mm_storeu_ps(lanes, acc);
+        float sum = fold_lanes(lanes, 1, 4);
+        row_sums[i] = sum + strang_cells(re_row + k, im_row + k, cols - k, d);
+    }
+}
+
+__attribute__((target("avx2")))
+static void torus_strang_rows_avx2(float *phi_re, float *phi_im, int rows, int cols,
+                                   const TorusDrive *d, float *row_sums) {
+    const __m256 c = _mm256_set1_ps(d->cos_dt);
+    const __m256 s = _mm256_set1_ps(d->sin_dt);
+    const __m256 e = _mm256_set1_ps(d->relax_e);
+    const __m256 pq = _mm256_set1_ps(d->relax_pq);
+    const __m256 on = _mm256_set1_ps(d->energy_on);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    for (int i = 0; i < rows; i++) {
+        float *re_row = phi_re + i * cols;
+        float *im_row = phi_im + i * cols;
+        __m256 acc = _mm256_setzero_ps();
+
+        int k = 0;
+        for (; k + 8 <= cols; k += 8) {
+            __m256 r = _mm256_loadu_ps(re_row + k);
+            __m256 im = _mm256_loadu_ps(im_row + k);
+            __m256 in = _mm256_add_ps(_mm256_mul_ps(r, r), _mm256_mul_ps(im, im));
+            __m256 g = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_add_ps(e, _mm256_mul_ps(pq, in))));
+            r = _mm256_mul_ps(r, g);
+            im = _mm256_mul_ps(im, g);
+            __m256 nr = _mm256_sub_ps(_mm256_mul_ps(r, c), _mm256_mul_ps(im, s));
+            __m256 ni = _mm256_add_ps(_mm256_mul_ps(r, s), _mm256_mul_ps(im, c));
+            in = _mm256_add_ps(_mm256_mul_ps(nr, nr), _mm256_mul_ps(ni, ni));
+            g = _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_add_ps(e, _mm256_mul_ps(pq, in))));
+            nr = _mm256_mul_ps(nr, g);
+            ni = _mm256_mul_ps(ni, g);
+            _mm256_storeu_ps(re_row + k, nr);
+            _mm256_storeu_ps(im_row + k, ni);
+            __m256 post = _mm256_add_ps(_mm256_mul_ps(nr, nr), _mm256_mul_ps(ni, ni));
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(post, on));
+        }
+
+        float lanes[8];
+        _mm256_storeu_ps(lanes, acc);
+        float sum = fold_lanes(lanes, 1, 8);
+        row_sums[i] = sum + strang_cells(re_row + k, im_row + k, cols - k, d);
+    }
+    _mm256_zeroupper();
+}
+
+__attribute__((target("avx512f")))
+static void torus_strang_rows_avx512(float *phi_re, float *phi_im, int rows, int cols,
+                                   const TorusDrive *d, float *row_sums) {
+    const __m512 c = _mm512_set1_ps(d->cos_dt);
+    const __m512 s = _mm512_set1_ps(d->sin_dt);
+    const __m512 e = _mm512_set1_ps(d->relax_e);
+    const __m512 pq = _mm512_set1_ps(d->relax_pq);
+    const __m512 on = _mm512_set1_ps(d->energy_on);
+    const __m512 one = _mm512_set1_ps(1.0f);
+
+    for (int i = 0; i < rows; i++) {
+        float *re_row = phi_re + i * cols;
+        float *im_row = phi_im + i * cols;
+        __m512 acc = _mm512_setzero_ps();
+
+        int k = 0;
+        for (; k + 16 <= cols; k += 16) {
+            __m512 r = _mm512_loadu_ps(re_row + k);
+            __m512 im = _mm512_loadu_ps(im_row + k);
+            __m512 in = _mm512_add_ps(_mm512_mul_ps(r, r), _mm512_mul_ps(im, im));
+            __m512 g = _mm512_div_ps(one, _mm512_sqrt_ps(_mm512_add_ps(e, _mm512_mul_ps(pq, in))));
+            r = _mm512_mul_ps(r, g);
+            im = _mm512_mul_ps(im, g);
+            __m512 nr = _mm512_sub_ps(_mm512_mul_ps(r, c), _mm512_mul_ps(im, s));
+            __m512 ni = _mm512_add_ps(_mm512_mul_ps(r, s), _mm512_mul_ps(im, c));
+            in = _mm512_add_ps(_mm512_mul_ps(nr, nr), _mm512_mul_ps(ni, ni));
+            g = _mm512_div_ps(one, _mm512_sqrt_ps(_mm512_add_ps(e, _mm512_mul_ps(pq, in))));
+            nr = _mm512_mul_ps(nr, g);
+            ni = _mm512_mul_ps(ni, g);
+            _mm512_storeu_ps(re_row + k, nr);
+            _mm512_storeu_ps(im_row + k, ni);
+            __m512 post = _mm512_add_ps(_mm512_mul_ps(nr, nr), _mm512_mul_ps(ni, ni));
+            acc = _mm512_add_ps(acc, _mm512_mul_ps(post, on));
+        }
+
+        float lanes[16];
+        _mm512_storeu_ps(lanes, acc);
+        float sum = fold_lanes(lanes, 1, 16);
+        row_sums[i] = sum + strang_cells(re_row + k, im_row + k, cols - k, d);
+    }
+    _mm256_zeroupper();
+}
+
+static unsigned long long read_xcr0(void) {
+    unsigned int lo, hi;
+    __asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((unsigned long long)hi << 32) | lo;
+}
+
+TorusIsa torus_isa_detect(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return TORUS_ISA_SCALAR;
+
+    TorusIsa best = (edx & bit_SSE2) ? TORUS_ISA_SSE2 : TORUS_ISA_SCALAR;
+
+    // AVX state must be enabled by the OS (OSXSAVE + XCR0 SSE/AVX bits)
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) return best;
+    unsigned long long xcr0 = read_xcr0();
+    if ((xcr0 & 0x6) != 0x6) return best;
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return best;
+    if (ebx & bit_AVX2) best = TORUS_ISA_AVX2;
+
+    // AVX-512 additionally needs opmask + ZMM upper state (XCR0 bits 5..7)
+    if ((ebx & bit_AVX512F) && (xcr0 & 0xE0) == 0xE0) best = TORUS_ISA_AVX512;
+    return best;
+}
+
+#else
+
+TorusIsa torus_isa_detect(void) {
+    return TORUS_ISA_SCALAR;
+}
+
+#endif // TORUS_HAVE_X86_SIMD
+
+typedef void (*TorusKernel)(float *, float *, int, int, const TorusDrive *, float *);
+
+// Selected ISA + 1 (0: not chosen yet). One atomic word, so workers that
+// run the first step at the same moment all see a whole selection.
+static _Atomic int active_choice = 0;
+
+static TorusKernel kernel_for(TorusIsa isa, int strang) {
+    switch (isa) {
+#ifdef TORUS_HAVE_X86_SIMD
+        case TORUS_ISA_SSE2:   return strang ? torus_strang_rows_sse2 : torus_rows_sse2;
+        case TORUS_ISA_AVX2:   return strang ? torus_strang_rows_avx2 : torus_rows_avx2;
+        case TORUS_ISA_AVX512: return strang ? torus_strang_rows_avx512 : torus_rows_avx512;
+#endif
+        default:               return strang ? torus_strang_rows_scalar : torus_rows_scalar;
+    }
+}
+
+int torus_isa_select(TorusIsa isa) {
+    if (isa > torus_isa_detect()) return -1;
+    atomic_store_explicit(&active_choice, (int)isa + 1, memory_order_relaxed);
+    return 0;
+}
+
+TorusIsa torus_isa_active(void) {
+    int choice = atomic_load_explicit(&active_choice, memory_order_relaxed);
+    if (choice == 0) {
+        // Racing first callers detect the same ISA; only one store lands
+        int expected = 0;
+        choice = (int)torus_isa_detect() + 1;
+        if (!atomic_compare_exchange_strong_explicit(&active_choice, &expected, choice,
+                                                     memory_order_relaxed, memory_order_relaxed)) {
+            choice = expected;
+        }
+    }
+    return (TorusIsa)(choice - 1);
+}
+
+int torus_isa_lanes(TorusIsa isa) {
+    switch (isa) {
+        case TORUS_ISA_SSE2:   return 4;
+        case TORUS_ISA_AVX2:   return 8;
+        case TORUS_ISA_AVX512: return 16;
+        default:               return 1;
+    }
+}
+
+void torus_fold_lanes(TorusIsa isa, const float *lanes, size_t stride, int n, float *sums) {
+    // One loop per width so each vectorizes across the rows
+    switch (torus_isa_lanes(isa)) {
+        case 4:  for (int m = 0; m < n; m++) sums[m] = fold_lanes(lanes + m, stride, 4) + sums[m]; break;
+        case 8:  for (int m = 0; m < n; m++) sums[m] = fold_lanes(lanes + m, stride, 8) + sums[m]; break;
+        case 16: for (int m = 0; m < n; m++) sums[m] = fold_lanes(lanes + m, stride, 16) + sums[m]; break;
+        default: for (int m = 0; m < n; m++) sums[m] = lanes[m] + sums[m]; break;
+    }
+}
+
+const char *torus_isa_name(TorusIsa isa) {
+    switch (isa) {
+        case TORUS_ISA_SSE2:   return "sse2";
+        case TORUS_ISA_AVX2:   return "avx2";
+        case TORUS_ISA_AVX512: return "avx512";
+        default:               return "scalar";
+    }
+}
+
+float torus_fused_update(float *phi_re, float *phi_im, int n, const TorusDrive *drive) {
+    float sum;
+    kernel_for(torus_isa_active(), drive->strang)(phi_re, phi_im, 1, n, drive, &sum);
+    return sum;
+}
+
+void torus_fused_rows(float *phi_re, float *phi_im, int rows, int cols,
+                      const TorusDrive *drive, float *row_sums) {
+    kernel_for(torus_isa_active(), drive->strang)(phi_re, phi_im, rows, cols, drive, row_sums);
+}
@@ -0,0 +1,86 @@
+#ifndef QCORE_TORUS_SIMD_H
+#define QCORE_TORUS_SIMD_H
+
+#include <stddef.h>
+
+/**
+ * @brief Per-step coefficients of the breathing projector
+ */
+typedef struct {
+    float cos_dt;           // Unitary rotation (Hamiltonian)
+    float sin_dt;
+    float pump;             // Metriplectic drive towards unit intensity
+    float decay;            // Stability-dependent loss
+    float dt;
+    float energy_on;        // On^2 weight of the sync clock reduction
+    int strang;             // 1: half relaxation, rotation, half relaxation
+    float relax_e;          // Strang: exp(-(pump - decay) * dt)
+    float relax_pq;         // Strang: pump * (1 - relax_e) / (pump - decay)
+} TorusDrive;
+
+/**
+ * @brief Instruction set used by the fused torus kernel
+ */
+typedef enum {
+    TORUS_ISA_SCALAR = 0,
+    TORUS_ISA_SSE2,
+    TORUS_ISA_AVX2,
+    TORUS_ISA_AVX512
+} TorusIsa;
+
+/**
+ * @brief Fused breathing step over n cells: rotate, drive, then accumulate
+ *        the post-update intensity weighted by energy_on.
+ * @return Sum of intensity * energy_on over the n cells.
+ *
+ * The per-cell update is bit-identical across ISAs (no FMA contraction);
+ * only the order of the reduction differs from the scalar reference.
+ */
+float torus_fused_update(float *phi_re, float *phi_im, int n, const TorusDrive *drive);
+
+/*
+ * With strang set, the drive is not an Euler step. Per cell,
+ * dΦ/dt = Φ·((1 - |Φ|²)·pump - decay) is integrated exactly over dt/2,
+ * Φ is rotated by (cos_dt, sin_dt), and the second dt/2 follows. |Φ|²
+ * obeys a logistic equation, so each half only rescales Φ:
+ *
+ *   Φ *= 1 / sqrt(relax_e + relax_pq·|Φ|²)
+ *
+ * The factor is positive for any dt. Cells never flip sign and |Φ|²
+ * moves monotonically toward 1 - decay/pump. No step size overshoots.
+ */
+
+/**
+ * @brief Same update over rows x cols cells laid out row-major, with one
+ *        reduction per row: row_sums[i] equals torus_fused_update() on row i.
+ */
+void torus_fused_rows(float *phi_re, float *phi_im, int rows, int cols,
+                      const TorusDrive *drive, float *row_sums);
+
+// Scalar reference implementation (always available, also in the kernel build)
+float torus_fused_scalar(float *phi_re, float *phi_im, int n, const TorusDrive *drive);
+
+// Runtime dispatch (CPUID on the host, scalar in the freestanding kernel).
+// The best ISA is chosen on first use; any thread may make that first call.
+TorusIsa torus_isa_detect(void);
+TorusIsa torus_isa_active(void);
+int torus_isa_select(TorusIsa isa);   // -1 if the CPU/OS cannot run it
+const char *torus_isa_name(TorusIsa isa);
+
+/*
+ * Reduction order of one row of n cells under an ISA: cell k < n - n % lanes
+ * adds into lane k % lanes, the remaining cells add into a tail sum in cell
+ * order, and the row sum is the folded lanes + tail (every accumulator
+ * starts at 0). The scalar reference is the one-lane case.
+ */
+#define TORUS_LANES_MAX 16
+int torus_isa_lanes(TorusIsa isa);
+
+/**
+ * @brief Finish n row reductions side by side: lane l of row m is at
+ *        lanes[l * stride + m]; sums[m] holds the row's tail sum on entry
+ *        and the row sum, rounded as the ISA's kernel rounds it, on return.
+ */
+void torus_fold_lanes(TorusIsa isa, const float *lanes, size_t stride, int n, float *sums);
+
+#endif // QCORE_TORUS_SIMD_H
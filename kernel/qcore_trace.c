@@ -0,0 +1,173 @@
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "qcore_trace.h"
+#include "qcore_ring.h"
+
+_Static_assert(sizeof(TraceRecord) == 64, "TraceRecord must stay one cache line");
+
+// The writer waits for at least capacity / TRACE_BATCH_DIV records, or
+// TRACE_MAX_IDLE polls, before issuing a write
+#define TRACE_BATCH_DIV 8
+#define TRACE_MAX_IDLE 10
+#define TRACE_POLL_NS 1000000L
+
+struct QcoreTrace {
+    QcoreRing ring;
+    void *storage;
+    int fd;
+    pthread_t writer;
+    _Atomic int stop;
+    _Atomic uint64_t dropped;   // Producer increments, anyone reads
+    uint64_t records;           // Writer only until joined
+    int write_error;            // Writer only until joined
+    uint32_t batch;
+};
+
+static int write_all(int fd, const void *buf, size_t n) {
+    const unsigned char *p = (const unsigned char *)buf;
+    while (n > 0) {
+        ssize_t w = write(fd, p, n);
+        if (w < 0) return -1;
+        p += w;
+        n -= (size_t)w;
+    }
+    return 0;
+}
+
+static void poll_sleep(void) {
+    struct timespec ts = {0, TRACE_POLL_NS};
+    nanosleep(&ts, NULL);
+}
+
+static void *trace_writer(void *p) {
+    QcoreTrace *t = (QcoreTrace *)p;
+    int idle = 0;
+    for (;;) {
+        int stopping = atomic_load_explicit(&t->stop, memory_order_acquire);
+        if (!stopping && qcore_ring_count(&t->ring) < t->batch && idle < TRACE_MAX_IDLE) {
+            poll_sleep();
+            idle++;
+            continue;
+        }
+        const void *first;
+        uint32_t n = qcore_ring_peek(&t->ring, &first);
+        if (n == 0) {
+            if (stopping) break;   // stop was set after the last push
+            idle = 0;
+            continue;
+        }
+        if (!t->write_error && write_all(t->fd, first, (size_t)n * sizeof(TraceRecord)) != 0) {
+            t->write_error = 1;
+        }
+        qcore_ring_consume(&t->ring, n);
+        t->records += n;
+        idle = 0;
+    }
+    return NULL;
+}
+
+static void fill_header(TraceFileHeader *h, uint64_t records, uint64_t dropped) {
+    memset(h, 0, sizeof(*h));
+    memcpy(h->magic, QCORE_TRACE_MAGIC, sizeof(h->magic));
+    h->version = QCORE_TRACE_VERSION;
+    h->record_bytes = sizeof(TraceRecord);
+    h->records = records;
+    h->dropped = dropped;
+}
+
+QcoreTrace *qcore_trace_open(const char *path, uint32_t capacity) {
+    if (capacity == 0) capacity = QCORE_TRACE_DEFAULT_CAPACITY;
+    QcoreTrace *t = calloc(1, sizeof(QcoreTrace));
+    if (!t) return NULL;
+    if (posix_memalign(&t->storage, QCORE_CACHE_LINE, (size_t)capacity * sizeof(TraceRecord)) != 0) {
+        free(t);
+        return NULL;
+    }
+    // Fault the ring in now rather than from the stepping thread
+    memset(t->storage, 0, (size_t)capacity * sizeof(TraceRecord));
+    if (qcore_ring_init(&t->ring, t->storage, sizeof(TraceRecord), capacity) != 0) {
+        free(t->storage);
+        free(t);
+        return NULL;
+    }
+    t->batch = (capacity / TRACE_BATCH_DIV) ? capacity / TRACE_BATCH_DIV : 1;
+
+    t->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    TraceFileHeader h;
+    fill_header(&h, 0, 0);
+    if (t->fd < 0 || write_all(t->fd, &h, sizeof(h)) != 0 ||
+        pthread_create(&t->writer, NULL, trace_writer, t) != 0) {
+        if (t->fd >= 0) close(t->fd);
+        free(t->storage);
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+void qcore_trace_fill(TraceRecord *rec, const SystemState *s, uint64_t step) {
+    rec->step = step;
+    rec->time = s->time;
+    rec->stability = s->stability;
+    rec->shear_flow = s->shear_flow;
+    rec->kink_amplitude = s->kink_amplitude;
+    rec->sync_clock_c = s->sync_clock_c;
+    rec->l2_error = s->l2_error;
+    rec->thermal_eff = s->thermal_eff;
+    rec->temperature = s->temperature;
+    rec->entropy_rate = s->entropy_rate;
+    rec->lyapunov_v = s->lyapunov_v;
+    rec->launder_v = s->launder.last_v;
+    rec->launder_rms = s->launder.current_rms;
+    rec->launder_duty = s->launder.duty_cycle;
+    rec->flags = s->is_lasalle_locked ? QCORE_TRACE_LOCKED : 0u;
+}
+
+int qcore_trace_record(QcoreTrace *t, const SystemState *state, uint64_t step) {
+    TraceRecord rec;
+    qcore_trace_fill(&rec, state, step);
+    if (qcore_ring_push(&t->ring, &rec) == 0) return 0;
+    atomic_fetch_add_explicit(&t->dropped, 1, memory_order_relaxed);
+    return -1;
+}
+
+uint64_t qcore_trace_dropped(const QcoreTrace *t) {
+    return atomic_load_explicit(&t->dropped, memory_order_relaxed);
+}
+
+int qcore_trace_close(QcoreTrace *t) {
+    if (!t) return 0;
+    atomic_store_explicit(&t->stop, 1, memory_order_release);
+    pthread_join(t->writer, NULL);
+
+    TraceFileHeader h;
+    fill_header(&h, t->records, qcore_trace_dropped(t));
+    int rc = t->write_error ? -1 : 0;
+    if (pwrite(t->fd, &h, sizeof(h), 0) != (ssize_t)sizeof(h)) rc = -1;
+    if (close(t->fd) != 0) rc = -1;
+    free(t->storage);
+    free(t);
+    return rc;
+}
+
+int qcore_trace_check_header(const TraceFileHeader *h) {
+    if (memcmp(h->magic, QCORE_TRACE_MAGIC, sizeof(h->magic)) != 0) return -1;
+    if (h->version != QCORE_TRACE_VERSION || h->record_bytes != sizeof(TraceRecord)) return -1;
+    return 0;
+}
+
+int qcore_trace_format(const TraceRecord *r, char *buf, size_t size) {
+    return snprintf(buf, size,
+                    "[PHYSICS_TRACE] Step %llu: t=%.3f Stability=%.2f, Flow=%.2f, Kink=%.2f, "
+                    "Sync=%.4f, L2=%.6f, Eff=%.2f, Temp=%.2f C, dS/dt=%.4f, V=%.6f, "
+                    "Launder V=%.1f RMS=%.4f Duty=%.4f%s",
+                    (unsigned long long)r->step, r->time, r->stability, r->shear_flow, r->kink_amplitude,
+                    r->sync_clock_c, r->l2_error, r->thermal_eff, r->temperature, r->entropy_rate,
+                    r->lyapunov_v, r->launder_v, r->launder_rms, r->launder_duty,
+                    (r->flags & QCORE_TRACE_LOCKED) ? " LOCKED" : "");
+}
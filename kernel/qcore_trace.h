@@ -0,0 +1,83 @@
+#ifndef QCORE_TRACE_H
+#define QCORE_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "qcore_metriplectic.h"
+
+/*
+ * Binary per-step trace (host only).
+ *
+ * The stepping thread copies a fixed 64-byte TraceRecord into an SPSC
+ * ring (qcore_ring.h) and never blocks or formats text; a writer thread
+ * drains the ring to the file in large blocks. When the ring is full the
+ * record is dropped and counted instead. qcore_trace_dump renders a trace
+ * file as the familiar [PHYSICS_TRACE] text.
+ *
+ * File: TraceFileHeader, then TraceRecord[records] (native endianness).
+ */
+
+#define QCORE_TRACE_MAGIC "QTRACE01"
+#define QCORE_TRACE_VERSION 1u
+#define QCORE_TRACE_DEFAULT_CAPACITY 65536u   // Records (4 MB of ring)
+
+/**
+ * @brief One traced step: one cache line
+ */
+typedef struct {
+    uint64_t step;
+    float time;
+    float stability;
+    float shear_flow;
+    float kink_amplitude;
+    float sync_clock_c;
+    float l2_error;
+    float thermal_eff;
+    float temperature;
+    float entropy_rate;
+    float lyapunov_v;
+    float launder_v;        // launder.last_v
+    float launder_rms;      // launder.current_rms
+    float launder_duty;     // launder.duty_cycle
+    uint32_t flags;         // QCORE_TRACE_LOCKED
+} TraceRecord;
+
+#define QCORE_TRACE_LOCKED 1u   // is_lasalle_locked
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_bytes;  // sizeof(TraceRecord)
+    uint64_t records;       // Written records (final after close)
+    uint64_t dropped;       // Records lost to a full ring (final after close)
+} TraceFileHeader;
+
+typedef struct QcoreTrace QcoreTrace;
+
+/**
+ * @brief Create the trace file and start its writer thread.
+ * @param capacity Ring size in records (power of two, 0 for the default).
+ * @return The recorder, or NULL on failure.
+ */
+QcoreTrace *qcore_trace_open(const char *path, uint32_t capacity);
+
+/**
+ * @brief Queue one record; never blocks (stepping thread only).
+ * @return 0 if queued, -1 if the ring was full and the record dropped.
+ */
+int qcore_trace_record(QcoreTrace *trace, const SystemState *state, uint64_t step);
+
+uint64_t qcore_trace_dropped(const QcoreTrace *trace);
+
+/**
+ * @brief Drain the ring, finalise the header counters and close the file.
+ * @return 0 on success, -1 if any write failed.
+ */
+int qcore_trace_close(QcoreTrace *trace);
+
+// Decoding
+void qcore_trace_fill(TraceRecord *rec, const SystemState *state, uint64_t step);
+int qcore_trace_check_header(const TraceFileHeader *header);  // 0 if readable by this build
+int qcore_trace_format(const TraceRecord *rec, char *buf, size_t size); // snprintf-style
+
+#endif // QCORE_TRACE_H
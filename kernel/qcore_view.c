@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include "qcore_view.h"
+#include "k_math.h"
+
+static const char *banner_lines[] = {
+    "  @@@@@@ @@@@@@@@@@   @@@@@@  @@@@@@@   @@@@@@ @@@ @@@  @@@@@@",
+    " !@@     @@! @@! @@! @@!  @@@ @@!  @@@ !@@     @@! !@@ !@@    ",
+    "  !@@!!  @!! !!@ @!@ @!@  !@! @!@@!@!   !@@!!   !@!@!   !@@!! ",
+    "     !:! !!:     !!: !!:  !!! !!:          !:!   !!:       !:!",
+    " ::.: :   :      :    : :. :   :       ::.: :    .:    ::.: : "
+};
+
+static void draw_banner(QcoreFramebuffer *fb, const SystemState *state) {
+    int start_x = 50;
+    int start_y = 30;
+    int char_w = 7;
+    int char_h = 12;
+
+    int scanline_x = (int)(state->time * 300.0f) % fb->width;
+
+    uint32_t base_color = 0x22d3ee; // Cyan
+    uint32_t alt_color = 0x3b82f6;  // Blue
+
+    if (state->stability < 40.0f) {
+        base_color = 0xef4444; // Red
+        alt_color = 0x475569;  // Slate
+    } else if (state->stability < 70.0f) {
+        base_color = 0x22d3ee; // Cyan
+        alt_color = 0xd946ef;  // Magenta
+    }
+
+    for (int y = 0; y < 5; y++) {
+        const char *line = banner_lines[y];
+        for (int x = 0; line[x] != '\0'; x++) {
+            if (line[x] == ' ') continue;
+
+            int px = start_x + x * char_w;
+            int py = start_y + y * char_h;
+
+            uint32_t color = (x % 2 == 0) ? base_color : alt_color;
+
+            // Scanline
+            if (px > scanline_x - 15 && px < scanline_x + 15) {
+                color = 0xFFFFFF;
+            }
+
+            // Glitch
+            if (state->stability < 50.0f) {
+                if (((int)(state->time * 50) % 7) == y) {
+                    color = (state->stability < 30.0f) ? 0xef4444 : 0xfacc15;
+                }
+            }
+
+            qcore_fb_draw_char(fb, px, py, line[x], color);
+        }
+    }
+}
+
+void qcore_view_render(QcoreFramebuffer *fb, const SystemState *state, const ViewStats *stats) {
+    qcore_fb_clear(fb, 0x000000);
+
+    // Dynamic Banner
+    draw_banner(fb, state);
+
+    // Header Decal
+    qcore_fb_draw_text(fb, 20, 110, "QUOREMIND SIM // INTEGRATED TOROIDAL-SHEAR MODEL v3.0", 0x3b82f6);
+
+    char buf[128];
+    snprintf(buf, sizeof(buf), "STABILITY: %.2f %% // SHEAR_FLOW: %.2f", state->stability, state->shear_flow);
+    qcore_fb_draw_text(fb, 20, 130, buf, 0x3b82f6);
+
+    snprintf(buf, sizeof(buf), "Bitstream: %.2f bits/s", state->bit_stream);
+    qcore_fb_draw_text(fb, 20, 150, buf, 0x3b82f6);
+
+    // Audio Diagnostics
+    snprintf(buf, sizeof(buf), "Acoustic Load: %.2f", state->audio_energy);
+    qcore_fb_draw_text(fb, 20, 170, buf, 0xa78bfa);
+    if (state->audio_coherence > 0.5f) {
+        qcore_fb_draw_text(fb, 20, 185, "RECOGNITION: LOCKED", 0x10b981);
+    }
+
+    snprintf(buf, sizeof(buf), "CLOCK_C: %.4f // GLOBAL_ID: %.2f rad", state->sync_clock_c, state->global_identity);
+    uint32_t clock_color = (state->sync_clock_c > 0.5) ? 0x10b981 : 0x60a5fa;
+    qcore_fb_draw_text(fb, 20, 205, buf, clock_color);
+
+    snprintf(buf, sizeof(buf), "BUS_THROUGHPUT: %.2f // BREATHING: %.2f", state->bus.bus_throughput, state->breathing_state);
+    qcore_fb_draw_text(fb, 20, 225, buf, clock_color);
+
+    snprintf(buf, sizeof(buf), "LAUNDER V: %.1f [Duty: %.2f] // FILTER: %.2f", state->launder.last_v, state->launder.duty_cycle, state->solenoid_filter);
+    qcore_fb_draw_text(fb, 20, 245, buf, (state->launder.last_v > 0.1) ? 0xfacc15 : 0x475569);
+
+    snprintf(buf, sizeof(buf), "TEMPERATURE: %.2f C // ENTROPY_RATE: %.4f", state->temperature, state->entropy_rate);
+    qcore_fb_draw_text(fb, 20, 265, buf, (state->temperature > 50.0) ? 0xef4444 : 0x22d3ee);
+
+    snprintf(buf, sizeof(buf), "PHYSICS: %.0f steps/s // RENDER: %.0f fps, %.2f ms (%s)",
+             stats->steps_hz, stats->fps, stats->frame_ms, stats->present);
+    qcore_fb_draw_text(fb, 20, 285, buf, 0x475569);
+
+    int cx = fb->width / 2;
+    int cy = fb->height / 2;
+
+    // 1. Draw the Sheared Channel (Z-Pinch)
+    // Intensity modulated by solenoid filter
+    uint32_t channel_color = (state->shear_flow > 9.0) ? 0xFFFFFF : 0x94a3b8;
+    for (int i = 0; i < 20; i++) {
+        float y_off = (float)i * 15.0f - 150.0f;
+        float amp = (100.0f - state->stability) * 0.5f;
+        int x_off = (int)(k_sin(state->time * 3.0f + (float)i * 0.5f) * amp);
+
+        if (state->solenoid_filter > 0.7f) {
+            qcore_fb_fill_rect(fb, cx + x_off - 10, cy + (int)y_off, 20, 10, channel_color);
+        }
+
+        // Photonic Packets (Only if unfiltered)
+        if (state->breathing_state > 0.5f && (int)(state->time * 10) % 20 == i && state->solenoid_filter > 0.8f) {
+            qcore_fb_fill_disc(fb, cx + x_off - 5, cy + (int)y_off, 10, 0xfacc15); // Yellow
+        }
+    }
+
+    // 2. Draw Toroidal Modulation (Resonance): one point per cell
+    uint32_t torus_color = (state->sync_clock_c > 0.5) ? 0x22d3ee : 0x3b82f6;
+    int dim = state->torus_dim;
+    float ring = (float)TORUS_DIM / (float)dim;
+    int size = (state->breathing_state > 0.5f) ? 6 : 3;
+    if (state->solenoid_filter < 0.85f && size == 6) size = 3;
+    if (state->solenoid_filter > 0.7f) {
+        for (int i = 0; i < dim; i++) {
+            float s, c;
+            k_sincos((float)i * (2.0f * PI / dim) + state->global_identity, &s, &c);
+            for (int j = 0; j < dim; j++) {
+                int k = TORUS_AT(state, i, j);
+                float intensity = state->phi_re[k] * state->phi_re[k] + state->phi_im[k] * state->phi_im[k];
+                if (intensity <= 0.1) continue;
+                float radius = 100.0f + (float)j * 15.0f * ring + intensity * 10.0f;
+
+                int px = cx + (int)(c * radius);
+                // Apply Nodal Bobbing to Y
+                int py = cy + (int)(s * radius + state->vortex_z * 15.0f);
+
+                qcore_fb_fill_disc(fb, px - size/2, py - size/2, size, torus_color);
+            }
+        }
+    }
+
+    // 3. Core Sync Meters
+    for (int i = 0; i < 4; i++) {
+        qcore_fb_draw_rect(fb, 650, 450 + i*30, 100, 20, 0x475569);
+        int fill = (int)(state->bus.core_sync[i] * 100);
+        uint32_t fill_color = (fill > 80) ? 0x10b981 : 0x3b82f6;
+        qcore_fb_fill_rect(fb, 650, 450 + i*30, fill, 20, fill_color);
+        snprintf(buf, sizeof(buf), "C%d", i);
+        qcore_fb_draw_text(fb, 630, 465 + i*30, buf, fill_color);
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef QCORE_VIEW_H
+#define QCORE_VIEW_H
+
+#include "qcore_metriplectic.h"
+#include "qcore_fb.h"
+
+/**
+ * @brief Render-loop measurements shown in the HUD.
+ */
+typedef struct {
+    double steps_hz;        // Physics steps per second
+    double fps;             // Presented frames per second
+    double frame_ms;        // Rasterize + present time
+    const char *present;    // "XShm" / "XPutImage"
+} ViewStats;
+
+/**
+ * @brief Rasterize qcore_sim's whole frame (banner, HUD, sheared channel,
+ *        torus point cloud, core sync meters) into fb. Every Φ cell is
+ *        drawn, whatever the grid size.
+ */
+void qcore_view_render(QcoreFramebuffer *fb, const SystemState *state, const ViewStats *stats);
+
+#endif // QCORE_VIEW_H
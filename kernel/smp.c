@@ -0,0 +1,330 @@
+#include "smp.h"
+#include "qcore_barrier.h"
+#include "tsc.h"
+
+#define LAPIC_DEFAULT_BASE 0xFEE00000u
+#define LAPIC_ID 0x020
+#define LAPIC_ICR_LO 0x300
+#define LAPIC_ICR_HI 0x310
+#define ICR_INIT 0x00000500u
+#define ICR_STARTUP 0x00000600u
+#define ICR_ASSERT 0x00004000u
+#define ICR_PENDING 0x00001000u     // Delivery status
+
+#define TABLE_CPUS_MAX 64           // Enabled CPUs read from the tables
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+// Address of a trampoline symbol once the code is copied to SMP_TRAMPOLINE
+#define TRAMP(sym) STR(SMP_TRAMPOLINE) " + " #sym " - smp_trampoline_start"
+
+// AP entry: real mode at SMP_TRAMPOLINE:0, CS = SMP_TRAMPOLINE >> 4. Load a
+// flat GDT, enter protected mode (caches back on: INIT leaves CD/NW set),
+// switch to the stack the BSP left in the mailbox and call the entry.
+__asm__(
+    ".text\n"
+    ".code16\n"
+    "smp_trampoline_start:\n"
+    "    cli\n"
+    "    cld\n"
+    "    xorw %ax, %ax\n"
+    "    movw %ax, %ds\n"
+    "    lgdtl " TRAMP(tramp_gdt_ptr) "\n"
+    "    movl %cr0, %eax\n"
+    "    andl $0x9FFFFFFF, %eax\n"
+    "    orl $0x21, %eax\n"                 // PE, NE
+    "    movl %eax, %cr0\n"
+    "    ljmpl $0x08, $" TRAMP(tramp_pm) "\n"
+    ".code32\n"
+    "tramp_pm:\n"
+    "    movw $0x10, %ax\n"
+    "    movw %ax, %ds\n"
+    "    movw %ax, %es\n"
+    "    movw %ax, %fs\n"
+    "    movw %ax, %gs\n"
+    "    movw %ax, %ss\n"
+    "    movl " TRAMP(smp_trampoline_stack) ", %esp\n"
+    "    call *" TRAMP(smp_trampoline_entry) "\n"
+    "tramp_halt:\n"
+    "    hlt\n"
+    "    jmp tramp_halt\n"
+    ".p2align 3\n"
+    "tramp_gdt:\n"
+    "    .quad 0\n"
+    "    .quad 0x00CF9A000000FFFF\n"        // 0x08: flat code
+    "    .quad 0x00CF92000000FFFF\n"        // 0x10: flat data
+    "tramp_gdt_ptr:\n"
+    "    .word 23\n"
+    "    .long " TRAMP(tramp_gdt) "\n"
+    "smp_trampoline_stack:\n"
+    "    .long 0\n"
+    "smp_trampoline_entry:\n"
+    "    .long 0\n"
+    "smp_trampoline_end:\n"
+);
+extern const uint8_t smp_trampoline_start[], smp_trampoline_end[];
+extern const uint8_t smp_trampoline_stack[], smp_trampoline_entry[];
+
+typedef struct {
+    int cpus;                       // Participants, BSP included
+    uint32_t job;                   // Bumped by the BSP to start a parallel_for
+    TorusRowFn fn;
+    void *arg;
+    int rows;
+    QcoreBarrier done;
+    uint32_t busy[SMP_MAX_CPUS];    // TSC ticks each core spent on its band
+    uint32_t span;                  // TSC ticks from job start to barrier release
+    uint32_t handed_bytes;          // Φ bytes written on APs, read by the BSP
+} SmpExecutor;
+
+static SmpExecutor executor;
+static int bsp_sense;
+
+static volatile uint32_t *lapic;
+static uint8_t apic_ids[SMP_MAX_CPUS];     // [0]: the BSP
+static int cpu_count = 1;
+static int ap_booting;                     // Index handed to the AP being started
+static int ap_started;
+
+// ---- MP / ACPI tables (identity-mapped, no paging) ----
+
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static const uint8_t *phys(uint32_t addr) {
+    // Through a register, so GCC does not take low constant addresses
+    // (the BIOS data area) for null-pointer arithmetic
+    const uint8_t *p;
+    __asm__ ( "" : "=r"(p) : "0"(addr) );
+    return p;
+}
+
+static int has_sig(const uint8_t *p, const char *sig) {
+    for (; *sig; sig++, p++) {
+        if (*p != (uint8_t)*sig) return 0;
+    }
+    return 1;
+}
+
+static int checksum_ok(const uint8_t *p, uint32_t len) {
+    uint8_t sum = 0;
+    while (len--) sum += *p++;
+    return sum == 0;
+}
+
+static const uint8_t *scan(uint32_t start, uint32_t len, const char *sig, uint32_t sum_len) {
+    for (uint32_t a = start; a + sum_len <= start + len; a += 16) {
+        if (has_sig(phys(a), sig) && checksum_ok(phys(a), sum_len)) return phys(a);
+    }
+    return 0;
+}
+
+// EBDA first KiB, last KiB of base memory, BIOS ROM
+static const uint8_t *find_bios_struct(const char *sig, uint32_t sum_len) {
+    uint32_t ebda = rd32(phys(0x40C)) >> 16 << 4;
+    const uint8_t *p = ebda ? scan(ebda, 1024, sig, sum_len) : 0;
+    if (!p) p = scan(0x9FC00, 1024, sig, sum_len);
+    if (!p) p = scan(0xE0000, 0x20000, sig, sum_len);
+    return p;
+}
+
+static int parse_madt(uint8_t *ids, uint32_t *lapic_base) {
+    const uint8_t *rsdp = find_bios_struct("RSD PTR ", 20);
+    if (!rsdp || !rd32(rsdp + 16)) return 0;
+    const uint8_t *rsdt = phys(rd32(rsdp + 16));
+    if (!has_sig(rsdt, "RSDT")) return 0;
+
+    uint32_t len = rd32(rsdt + 4);
+    for (uint32_t off = 36; off + 4 <= len; off += 4) {
+        const uint8_t *madt = phys(rd32(rsdt + off));
+        if (!has_sig(madt, "APIC")) continue;
+        *lapic_base = rd32(madt + 36);
+        uint32_t madt_len = rd32(madt + 4);
+        int n = 0;
+        for (uint32_t e = 44; e + 2 <= madt_len && madt[e + 1] >= 2; e += madt[e + 1]) {
+            // Type 0: processor local APIC (id at +3, flags at +4, bit 0 enabled)
+            if (madt[e] == 0 && (madt[e + 4] & 1) && n < TABLE_CPUS_MAX) ids[n++] = madt[e + 3];
+        }
+        return n;
+    }
+    return 0;
+}
+
+static int parse_mp(uint8_t *ids, uint32_t *lapic_base) {
+    const uint8_t *fp = find_bios_struct("_MP_", 16);
+    if (!fp || !rd32(fp + 4)) return 0;
+    const uint8_t *cfg = phys(rd32(fp + 4));
+    if (!has_sig(cfg, "PCMP")) return 0;
+
+    *lapic_base = rd32(cfg + 36);
+    uint32_t entries = (uint32_t)cfg[34] | ((uint32_t)cfg[35] << 8);
+    const uint8_t *e = cfg + 44;
+    int n = 0;
+    for (uint32_t i = 0; i < entries; i++) {
+        if (e[0] == 0) {
+            // Processor: APIC id at +1, flags at +3 (bit 0 enabled)
+            if ((e[3] & 1) && n < TABLE_CPUS_MAX) ids[n++] = e[1];
+            e += 20;
+        } else {
+            e += 8;
+        }
+    }
+    return n;
+}
+
+// ---- Local APIC ----
+
+static uint32_t lapic_read(uint32_t reg) {
+    return lapic[reg / 4];
+}
+
+static void lapic_write(uint32_t reg, uint32_t val) {
+    lapic[reg / 4] = val;
+    (void)lapic_read(LAPIC_ID);     // Serialize the write
+}
+
+static void lapic_ipi(uint8_t apic_id, uint32_t command) {
+    lapic_write(LAPIC_ICR_HI, (uint32_t)apic_id << 24);
+    lapic_write(LAPIC_ICR_LO, command);
+    for (int spins = 0; (lapic_read(LAPIC_ICR_LO) & ICR_PENDING) && spins < 1000; spins++) {
+        k_delay_us(1);
+    }
+}
+
+// ---- Torus executor ----
+
+static void run_band(int index) {
+    SmpExecutor *ex = &executor;
+    int begin = ex->rows * index / ex->cpus;
+    int end = ex->rows * (index + 1) / ex->cpus;
+    uint64_t start = rdtsc();
+    if (begin < end) ex->fn(ex->arg, begin, end);
+    ex->busy[index] = (uint32_t)(rdtsc() - start);
+}
+
+static void ap_loop(int index) {
+    uint32_t seen = 0;
+    int sense = 0;
+    for (;;) {
+        uint32_t job;
+        while ((job = __atomic_load_n(&executor.job, __ATOMIC_ACQUIRE)) == seen) {
+            __asm__ volatile ( "pause" );
+        }
+        seen = job;
+        run_band(index);
+        qcore_barrier_wait(&executor.done, &sense);
+    }
+}
+
+static void ap_main(void) {
+#ifdef KERNEL_SSE
+    // Same FPU/SSE setup as _start in boot.asm (the BSP checked for SSE2)
+    uint32_t cr;
+    __asm__ volatile ( "mov %%cr0, %0" : "=r"(cr) );
+    cr = (cr & ~(1u << 2)) | (1u << 1) | (1u << 5);
+    __asm__ volatile ( "mov %0, %%cr0" : : "r"(cr) );
+    __asm__ volatile ( "mov %%cr4, %0" : "=r"(cr) );
+    cr |= (1u << 9) | (1u << 10);
+    __asm__ volatile ( "mov %0, %%cr4" : : "r"(cr) );
+#endif
+    __asm__ volatile ( "fninit" );
+    int index = __atomic_load_n(&ap_booting, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&ap_started, 1, __ATOMIC_RELEASE);
+    ap_loop(index);
+}
+
+static void smp_parallel_for(void *ctx, int rows, TorusRowFn fn, void *arg) {
+    SmpExecutor *ex = (SmpExecutor *)ctx;
+    ex->fn = fn;
+    ex->arg = arg;
+    ex->rows = rows;
+    uint64_t start = rdtsc();
+    __atomic_store_n(&ex->job, ex->job + 1, __ATOMIC_RELEASE);
+    run_band(0);
+    qcore_barrier_wait(&ex->done, &bsp_sense);
+    ex->span = (uint32_t)(rdtsc() - start);
+
+    // Bands 1.. were produced on other cores; the BSP reads them next
+    // (row sums now, Φ when the frame is drawn). Rows are square: N x N.
+    int ap_rows = rows - rows / ex->cpus;
+    ex->handed_bytes = (uint32_t)ap_rows * (uint32_t)rows * 2u * sizeof(float) + (uint32_t)ap_rows * sizeof(float);
+}
+
+static void smp_bus_report(void *ctx, CoreBus *bus) {
+    SmpExecutor *ex = (SmpExecutor *)ctx;
+    float span = ex->span ? (float)ex->span : 1.0f;
+    float busy = 0.0f;
+    for (int i = 0; i < SMP_MAX_CPUS; i++) {
+        float share = (i < ex->cpus) ? (float)ex->busy[i] / span : 0.0f;
+        if (share > 1.0f) share = 1.0f;
+        bus->core_sync[i] = share;
+        busy += share;
+    }
+    bus->packet_loss = 1.0f - busy / (float)ex->cpus;
+    bus->bus_throughput = (float)ex->handed_bytes / (span / (float)tsc_ticks_per_us());
+}
+
+// ---- Bring-up ----
+
+static int start_ap(int index, uint8_t *stack) {
+    volatile uint8_t *tramp = (volatile uint8_t *)SMP_TRAMPOLINE;
+    uint32_t size = (uint32_t)(smp_trampoline_end - smp_trampoline_start);
+    for (uint32_t i = 0; i < size; i++) tramp[i] = smp_trampoline_start[i];
+
+    uint32_t stack_top = (uint32_t)(uintptr_t)(stack + SMP_AP_STACK);
+    uint32_t entry = (uint32_t)(uintptr_t)ap_main;
+    *(volatile uint32_t *)(tramp + (smp_trampoline_stack - smp_trampoline_start)) = stack_top;
+    *(volatile uint32_t *)(tramp + (smp_trampoline_entry - smp_trampoline_start)) = entry;
+    __atomic_store_n(&ap_booting, index, __ATOMIC_RELEASE);
+    __atomic_store_n(&ap_started, 0, __ATOMIC_RELEASE);
+
+    // INIT, then up to two STARTUPs (vector = trampoline page)
+    lapic_ipi(apic_ids[index], ICR_INIT | ICR_ASSERT);
+    k_delay_ms(10);
+    for (int sipi = 0; sipi < 2 && !__atomic_load_n(&ap_started, __ATOMIC_ACQUIRE); sipi++) {
+        lapic_ipi(apic_ids[index], ICR_STARTUP | (SMP_TRAMPOLINE >> 12));
+        k_delay_us(200);
+    }
+    for (int ms = 0; ms < 100 && !__atomic_load_n(&ap_started, __ATOMIC_ACQUIRE); ms++) {
+        k_delay_ms(1);
+    }
+    return __atomic_load_n(&ap_started, __ATOMIC_ACQUIRE) ? 0 : -1;
+}
+
+int smp_init(Arena *arena) {
+    uint8_t ids[TABLE_CPUS_MAX];
+    uint32_t lapic_base = LAPIC_DEFAULT_BASE;
+    int found = parse_madt(ids, &lapic_base);
+    if (found == 0) found = parse_mp(ids, &lapic_base);
+    if (found < 2) return cpu_count;
+
+    lapic = (volatile uint32_t *)(uintptr_t)lapic_base;
+    apic_ids[0] = (uint8_t)(lapic_read(LAPIC_ID) >> 24);
+
+    for (int i = 0; i < found && cpu_count < SMP_MAX_CPUS; i++) {
+        if (ids[i] == apic_ids[0]) continue;
+        uint8_t *stack = arena ? (uint8_t *)arena_alloc(arena, SMP_AP_STACK, 16) : 0;
+        if (!stack) break;
+        apic_ids[cpu_count] = ids[i];
+        if (start_ap(cpu_count, stack) == 0) {
+            cpu_count++;
+        } else {
+            arena_release(arena, stack, SMP_AP_STACK);
+        }
+    }
+    return cpu_count;
+}
+
+int smp_cpus(void) {
+    return cpu_count;
+}
+
+void smp_attach(SystemState *state) {
+    if (cpu_count < 2) return;
+    executor.cpus = cpu_count;
+    qcore_barrier_init(&executor.done, cpu_count);
+    state->executor.parallel_for = smp_parallel_for;
+    state->executor.bus_report = smp_bus_report;
+    state->executor.ctx = &executor;
+}
@@ -0,0 +1,47 @@
+#ifndef SMP_H
+#define SMP_H
+
+#include <stdint.h>
+#include "qcore_metriplectic.h"
+#include "arena.h"
+
+/*
+ * Application processor bring-up and the per-core torus executor
+ * (kernel only).
+ *
+ * smp_init() finds the CPUs in the ACPI MADT (or, failing that, the Intel
+ * MP table), then starts every enabled AP with INIT-SIPI-SIPI through a
+ * real-mode trampoline copied to SMP_TRAMPOLINE. Each AP gets its own
+ * stack from the boot arena, switches to flat protected mode with interrupts off and spins
+ * waiting for torus work.
+ *
+ * smp_attach() routes solve_step's torus update through the cores: each
+ * owns a contiguous band of rows, and all of them meet once per step at a
+ * sense-reversing barrier (qcore_barrier.h). The executor times every
+ * band with the TSC and reports the CoreBus from those numbers:
+ *   core_sync[i]    busy share of the step for core i (1: critical path)
+ *   bus_throughput  Φ bytes produced on APs and handed to the BSP,
+ *                   per microsecond of step
+ *   packet_loss     share of the cores' step time spent idle at the barrier
+ */
+
+#define SMP_MAX_CPUS 4              // One per CoreBus core
+#define SMP_TRAMPOLINE 0x8000       // Real-mode entry (4 KiB aligned, < 1 MiB)
+#define SMP_AP_STACK 16384u
+
+/**
+ * @brief Start the application processors, SMP_AP_STACK bytes of arena each.
+ *        Needs tsc_calibrate() first (INIT/SIPI timing).
+ * @return CPUs online, BSP included (1 if no tables, no APs or no arena).
+ */
+int smp_init(Arena *arena);
+
+int smp_cpus(void);
+
+/**
+ * @brief Route state's torus update and CoreBus through the cores
+ *        (no-op on a single CPU).
+ */
+void smp_attach(SystemState *state);
+
+#endif // SMP_H
@@ -0,0 +1,41 @@
+#include "tsc.h"
+#include "io.h"
+
+#define PIT_CH2 0x42
+#define PIT_CMD 0x43
+#define PIT_GATE 0x61           // bit 0: ch2 gate, bit 1: speaker, bit 5: ch2 OUT
+#define PIT_BASE_HZ 1193182u
+#define CALIBRATE_US 10000u
+
+static uint32_t ticks_per_us;
+
+uint32_t tsc_calibrate(void) {
+    uint16_t count = (uint16_t)(PIT_BASE_HZ / (1000000u / CALIBRATE_US));
+
+    outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);  // Gate on, speaker off
+    outb(PIT_CMD, 0xB0);                            // Channel 2, lobyte/hibyte, mode 0
+    outb(PIT_CH2, (uint8_t)(count & 0xFF));
+    outb(PIT_CH2, (uint8_t)(count >> 8));
+
+    uint64_t start = rdtsc();
+    while ((inb(PIT_GATE) & 0x20) == 0) {}           // OUT goes high at terminal count
+    // 10 ms fits 32 bits below 400 GHz and avoids libgcc's 64-bit divide
+    uint32_t per_us = (uint32_t)(rdtsc() - start) / CALIBRATE_US;
+    ticks_per_us = per_us ? per_us : 1;
+    return ticks_per_us;
+}
+
+uint32_t tsc_ticks_per_us(void) {
+    return ticks_per_us ? ticks_per_us : tsc_calibrate();
+}
+
+void k_delay_us(uint32_t us) {
+    uint64_t end = rdtsc() + (uint64_t)us * tsc_ticks_per_us();
+    while (rdtsc() < end) {
+        __asm__ volatile ( "pause" );
+    }
+}
+
+void k_delay_ms(uint32_t ms) {
+    k_delay_us(ms * 1000u);
+}
@@ -0,0 +1,29 @@
+#ifndef TSC_H
+#define TSC_H
+
+#include <stdint.h>
+
+/*
+ * Time-stamp-counter delays calibrated against PIT channel 2 (kernel only).
+ * Channel 2 is polled, so calibration works before interrupts are enabled
+ * and leaves the channel 0 tick alone.
+ */
+
+static inline uint64_t rdtsc(void) {
+    uint32_t lo, hi;
+    __asm__ volatile ( "rdtsc" : "=a"(lo), "=d"(hi) );
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/**
+ * @brief Measure the TSC rate over a 10 ms PIT window.
+ * @return TSC ticks per microsecond (at least 1).
+ */
+uint32_t tsc_calibrate(void);
+
+uint32_t tsc_ticks_per_us(void);    // Calibrates on first use
+
+void k_delay_ms(uint32_t ms);
+void k_delay_us(uint32_t us);
+
+#endif // TSC_H
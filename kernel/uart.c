@@ -0,0 +1,89 @@
+#include "uart.h"
+#include "idt.h"
+#include "io.h"
+#include "qcore_ring.h"
+
+#define COM1 0x3F8
+#define UART_THR (COM1 + 0)
+#define UART_DLL (COM1 + 0)
+#define UART_IER (COM1 + 1)
+#define UART_DLM (COM1 + 1)
+#define UART_FCR (COM1 + 2)
+#define UART_IIR (COM1 + 2)
+#define UART_LCR (COM1 + 3)
+#define UART_MCR (COM1 + 4)
+#define UART_LSR (COM1 + 5)
+
+#define IER_THRE 0x02
+#define LSR_THRE 0x20
+#define MCR_OUT2 0x08           // Gates the UART's IRQ line on PC hardware
+#define UART_FIFO_BYTES 16
+#define UART_IRQ 4
+
+static QcoreRing tx;
+static unsigned char tx_storage[UART_TX_RING];
+static volatile int tx_active;  // THRE interrupt enabled; the ISR owns the FIFO
+static volatile uint32_t dropped;
+
+// Interrupts off: the ISR's view of tx_active must not change under it
+static void fill_fifo(void) {
+    unsigned char chunk[UART_FIFO_BYTES];
+    uint32_t n = qcore_ring_pop(&tx, chunk, UART_FIFO_BYTES);
+    for (uint32_t i = 0; i < n; i++) outb(UART_THR, chunk[i]);
+    if (n == 0) {
+        tx_active = 0;
+        outb(UART_IER, 0);
+    }
+}
+
+static void uart_irq(void) {
+    if (inb(UART_IIR) & 0x01) return; // Nothing pending
+    if (inb(UART_LSR) & LSR_THRE) fill_fifo();
+}
+
+void uart_init(uint32_t baud) {
+    if (baud == 0 || baud > UART_BAUD_MAX) baud = UART_BAUD_MAX;
+    uint32_t divisor = UART_BAUD_MAX / baud;
+
+    qcore_ring_init(&tx, tx_storage, 1, UART_TX_RING);
+    outb(UART_IER, 0);
+    outb(UART_LCR, 0x80);               // DLAB
+    outb(UART_DLL, (uint8_t)(divisor & 0xFF));
+    outb(UART_DLM, (uint8_t)(divisor >> 8));
+    outb(UART_LCR, 0x03);               // 8N1
+    outb(UART_FCR, 0xC7);               // FIFOs on, both cleared, 14-byte RX trigger
+    outb(UART_MCR, MCR_OUT2 | 0x03);    // DTR, RTS, OUT2
+    irq_install(UART_IRQ, uart_irq);
+}
+
+int uart_write(const char *buf, uint32_t n) {
+    if (UART_TX_RING - qcore_ring_count(&tx) < n) {
+        dropped += n;
+        return -1;
+    }
+    for (uint32_t i = 0; i < n; i++) qcore_ring_push(&tx, &buf[i]);
+
+    uint32_t flags = irq_save();
+    if (!tx_active) {
+        // Enabling THRE with the holding register empty raises the
+        // interrupt at once; the ISR then keeps the FIFO fed
+        tx_active = 1;
+        outb(UART_IER, IER_THRE);
+    }
+    irq_restore(flags);
+    return 0;
+}
+
+uint32_t uart_dropped(void) {
+    return dropped;
+}
+
+void serial_putc(char c) {
+    uart_write(&c, 1);
+}
+
+void serial_print(const char *s) {
+    uint32_t n = 0;
+    while (s[n]) n++;
+    uart_write(s, n);
+}
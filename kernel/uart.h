@@ -0,0 +1,37 @@
+#ifndef UART_H
+#define UART_H
+
+#include <stdint.h>
+
+/*
+ * Interrupt-driven COM1 output (kernel only).
+ *
+ * serial_print()/serial_putc() copy into a TX ring (qcore_ring.h) and
+ * return at once; the THR-empty interrupt (IRQ 4) refills the 16550's
+ * 16-byte FIFO from the ring. Drop policy: a write that does not fit in
+ * the free space is discarded whole, so the line is never cut mid-way,
+ * and its bytes are counted in uart_dropped().
+ */
+
+#define UART_BAUD_MAX 115200u   // 1.8432 MHz clock / 16, divisor 1
+#define UART_TX_RING 8192u      // Bytes, power of two
+
+/**
+ * @brief Program COM1 (8N1, FIFOs on) and install its IRQ.
+ *        Needs idt_init() first; output flows once interrupts are enabled.
+ * @param baud Rounded down to UART_BAUD_MAX / divisor.
+ */
+void uart_init(uint32_t baud);
+
+/**
+ * @brief Queue n bytes, all or nothing.
+ * @return 0 if queued, -1 if dropped.
+ */
+int uart_write(const char *buf, uint32_t n);
+
+uint32_t uart_dropped(void);    // Bytes discarded since boot
+
+void serial_putc(char c);
+void serial_print(const char *s);
+
+#endif // UART_H
@@ -1,14 +1,27 @@
 #include "vga_driver.h"
 
+// back: the frame being composed. shown: what VGA memory holds, so the
+// flush never has to read the (slow) MMIO range back.
+typedef union {
+    uint16_t cell[COLS * ROWS];
+    uint32_t pair[COLS * ROWS / 2];
+} TextFrame;
+
+static TextFrame back;
+static TextFrame shown;
+static int shown_valid; // 0 until the first flush: the screen holds BIOS text
+
 void k_clear(uint8_t bg) {
-    for (int i = 0; i < COLS * ROWS; i++) {
-        TEXT_VGA_MEM[i] = (uint16_t)' ' | ((uint16_t)(bg << 4) << 8);
+    uint16_t blank = (uint16_t)' ' | ((uint16_t)(bg << 4) << 8);
+    uint32_t pair = (uint32_t)blank | ((uint32_t)blank << 16);
+    for (int i = 0; i < COLS * ROWS / 2; i++) {
+        back.pair[i] = pair;
     }
 }
 
 void k_putc(int x, int y, char c, uint8_t fg, uint8_t bg) {
     if (x >= 0 && x < COLS && y >= 0 && y < ROWS) {
-        TEXT_VGA_MEM[y * COLS + x] = (uint16_t)c | (uint16_t)((fg | (bg << 4)) << 8);
+        back.cell[y * COLS + x] = (uint16_t)(uint8_t)c | (uint16_t)((fg | (bg << 4)) << 8);
     }
 }
 
@@ -19,3 +32,17 @@ void k_print_at(int x, int y, const char *s, uint8_t fg, uint8_t bg) {
         i++;
     }
 }
+
+uint32_t k_flush(void) {
+    volatile uint32_t *vram = (volatile uint32_t *)TEXT_VGA_MEM;
+    uint32_t written = 0;
+    for (int i = 0; i < COLS * ROWS / 2; i++) {
+        uint32_t pair = back.pair[i];
+        if (shown_valid && pair == shown.pair[i]) continue;
+        vram[i] = pair;
+        shown.pair[i] = pair;
+        written += 2;
+    }
+    shown_valid = 1;
+    return written;
+}
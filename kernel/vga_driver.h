@@ -21,8 +21,18 @@
 #define YELLOW     0xE
 #define WHITE      0xF
 
+// Drawing goes to an in-RAM back buffer; nothing reaches the screen
+// until k_flush()
 void k_clear(uint8_t bg);
 void k_putc(int x, int y, char c, uint8_t fg, uint8_t bg);
 void k_print_at(int x, int y, const char *s, uint8_t fg, uint8_t bg);
 
+/**
+ * @brief Copy the back buffer to VGA memory, writing only the cells that
+ *        differ from what is on screen (32-bit stores, two cells each).
+ *        The first flush after boot writes every cell.
+ * @return Cells written to VGA memory by this flush.
+ */
+uint32_t k_flush(void);
+
 #endif
@@ -0,0 +1,140 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <time.h>
+#include "../kernel/qcore_adaptive.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static float field_diff(const SystemState *a, const SystemState *b) {
+    float worst = 0.0f;
+    for (int k = 0; k < a->torus_dim * a->torus_dim; k++) {
+        float d = fabsf(a->phi_re[k] - b->phi_re[k]) + fabsf(a->phi_im[k] - b->phi_im[k]);
+        if (d > worst) worst = d;
+    }
+    return worst;
+}
+
+// Frames until is_lasalle_locked (or limit); *sec is the wall time spent
+static int frames_to_lock(SystemState *s, float dt, QcoreAdaptive *ctl, int limit, double *sec) {
+    double t0 = now_sec();
+    int n = 0;
+    while (!s->is_lasalle_locked && n < limit) {
+        if (ctl) assert(solve_step_adaptive(s, dt, ctl) >= 1);
+        else solve_step(s, dt);
+        n++;
+    }
+    *sec = now_sec() - t0;
+    return n;
+}
+
+int main() {
+    SystemState s;
+    QcoreAdaptive ctl;
+    memset(&s, 0, sizeof(s));
+
+    printf("[TEST] Arguments and grid size are checked...\n");
+    assert(qcore_adaptive_init(&ctl, 8, 0.0f, 0.0f, 1e-4f, 0.5f) == -1);
+    assert(qcore_adaptive_init(&ctl, 8, 1e-3f, 1e-3f, 0.0f, 0.5f) == -1);
+    assert(qcore_adaptive_init(&ctl, 8, 1e-3f, 1e-3f, 0.5f, 0.1f) == -1);
+    assert(qcore_adaptive_init(&ctl, 8, 1e-3f, 1e-3f, 1e-4f, 0.5f) == 0);
+    assert(init_system_dim(&s, 16) == 0);
+    assert(solve_step_adaptive(&s, 0.05f, &ctl) == -1);
+    release_system(&s);
+    printf("PASS: Bad tolerances, bounds and grid sizes rejected.\n");
+
+    printf("[TEST] Frames land on t + dt; counters add up...\n");
+    assert(init_system(&s) == 0);
+    for (int f = 0; f < 200; f++) {
+        float t0 = s.time;
+        int n = solve_step_adaptive(&s, 0.3f, &ctl);
+        assert(n >= 1);
+        assert(fabsf(s.time - (t0 + 0.3f)) < 1e-5f);
+        assert(ctl.h >= ctl.dt_min && ctl.h <= ctl.dt_max);
+    }
+    assert(ctl.accepted >= 200 && ctl.floored == 0);
+    assert(ctl.rhs_evals >= 6 * (ctl.accepted + ctl.rejected));
+    assert(s.stability >= 0.0f && s.stability <= 100.0f);
+    printf("  200 frames of 0.3: %llu accepted, %llu rejected, %llu evals\n",
+           (unsigned long long)ctl.accepted, (unsigned long long)ctl.rejected,
+           (unsigned long long)ctl.rhs_evals);
+    qcore_adaptive_reset(&ctl);
+    assert(ctl.accepted == 0 && ctl.rejected == 0 && ctl.h == 0.0f);
+    release_system(&s);
+    printf("PASS: Exact frame ends, bounded substeps.\n");
+
+    printf("[TEST] Tighter tolerances take more substeps...\n");
+    QcoreAdaptive tight;
+    assert(qcore_adaptive_init(&tight, 8, 1e-5f, 1e-5f, 1e-5f, 0.5f) == 0);
+    SystemState a, b;
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    assert(init_system(&a) == 0);
+    assert(init_system(&b) == 0);
+    for (int f = 0; f < 100; f++) {
+        solve_step_adaptive(&a, 0.5f, &ctl);
+        solve_step_adaptive(&b, 0.5f, &tight);
+    }
+    assert(tight.accepted > ctl.accepted);
+    release_system(&a);
+    release_system(&b);
+    printf("PASS: %llu vs %llu substeps.\n", (unsigned long long)tight.accepted,
+           (unsigned long long)ctl.accepted);
+    qcore_adaptive_release(&tight);
+
+    printf("[TEST] Closer than Euler to a tight reference at dt 0.25...\n");
+    // The launder only depends on its own state and t, so all three runs
+    // see the same voltage sequence on the same frame grid
+    QcoreAdaptive ref;
+    assert(qcore_adaptive_init(&ref, 8, 1e-6f, 1e-6f, 1e-5f, 0.05f) == 0);
+    SystemState r, e;
+    memset(&r, 0, sizeof(r));
+    memset(&e, 0, sizeof(e));
+    assert(init_system(&r) == 0);
+    assert(init_system(&e) == 0);
+    assert(init_system(&a) == 0);
+    qcore_adaptive_reset(&ctl);
+    for (int f = 0; f < 40; f++) {
+        solve_step_adaptive(&r, 0.25f, &ref);
+        solve_step_adaptive(&a, 0.25f, &ctl);
+        solve_step(&e, 0.25f);
+    }
+    float euler_rho = fabsf(e.stability - r.stability), adapt_rho = fabsf(a.stability - r.stability);
+    float euler_phi = field_diff(&e, &r), adapt_phi = field_diff(&a, &r);
+    printf("  |drho| Euler %.4f, adaptive %.4f; |dPhi| Euler %.4f, adaptive %.4f\n",
+           euler_rho, adapt_rho, euler_phi, adapt_phi);
+    assert(adapt_rho < euler_rho && adapt_phi < euler_phi);
+    assert(fabsf(a.temperature - r.temperature) < fabsf(e.temperature - r.temperature));
+    release_system(&r);
+    release_system(&e);
+    release_system(&a);
+    qcore_adaptive_release(&ref);
+    printf("PASS: Error control beats the Euler step.\n");
+
+    printf("[TEST] Wall time to LaSalle lock, Euler vs adaptive...\n");
+    const float dts[] = {0.05f, 0.25f};
+    for (int i = 0; i < 2; i++) {
+        double euler_sec, adapt_sec;
+        assert(init_system(&e) == 0);
+        int euler_frames = frames_to_lock(&e, dts[i], NULL, 20000, &euler_sec);
+        assert(init_system(&a) == 0);
+        qcore_adaptive_reset(&ctl);
+        int adapt_frames = frames_to_lock(&a, dts[i], &ctl, 20000, &adapt_sec);
+        assert(e.is_lasalle_locked && a.is_lasalle_locked);
+        printf("  dt %.2f: Euler %d frames %.3f ms, adaptive %d frames (%llu substeps) %.3f ms\n",
+               dts[i], euler_frames, euler_sec * 1e3, adapt_frames,
+               (unsigned long long)ctl.accepted, adapt_sec * 1e3);
+        release_system(&e);
+        release_system(&a);
+    }
+    qcore_adaptive_release(&ctl);
+    printf("PASS: Both paths lock.\n");
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
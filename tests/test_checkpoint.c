@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <unistd.h>
+#include "../kernel/qcore_checkpoint.h"
+
+#define CKPT_PATH "test_checkpoint.bin"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Scalars byte for byte, the torus by content (each state owns its buffers)
+static int same_state(const SystemState *a, const SystemState *b) {
+    SystemState tmp;
+    memcpy(&tmp, a, sizeof(SystemState));
+    tmp.phi_re = b->phi_re;
+    tmp.phi_im = b->phi_im;
+    tmp.row_sums = b->row_sums;
+    memcpy(&tmp.field, &b->field, sizeof(FieldBlock));
+    memcpy(&tmp.executor, &b->executor, sizeof(TorusExecutor));
+    if (memcmp(&tmp, b, sizeof(SystemState)) != 0) return 0;
+    size_t bytes = (size_t)a->torus_dim * a->torus_dim * sizeof(float);
+    return memcmp(a->phi_re, b->phi_re, bytes) == 0 &&
+           memcmp(a->phi_im, b->phi_im, bytes) == 0;
+}
+
+static void patch_file(long offset, const void *bytes, size_t n) {
+    FILE *f = fopen(CKPT_PATH, "r+b");
+    assert(f);
+    fseek(f, offset, SEEK_SET);
+    fwrite(bytes, 1, n, f);
+    fclose(f);
+}
+
+int main() {
+    printf("[TEST] Resumed run is bit-identical to an uninterrupted one...\n");
+    SystemState full, part, resumed;
+    memset(&full, 0, sizeof(full));
+    memset(&part, 0, sizeof(part));
+    memset(&resumed, 0, sizeof(resumed));
+    assert(init_system_dim(&full, 32) == 0);
+    assert(init_system_dim(&part, 32) == 0);
+    full.shear_flow = part.shear_flow = 9.0f;
+    for (int i = 0; i < 3000; i++) solve_step(&full, 0.05f);
+
+    for (int i = 0; i < 1200; i++) solve_step(&part, 0.05f);
+    assert(qcore_checkpoint_save(&part, CKPT_PATH) == 0);
+    assert(access(CKPT_PATH ".tmp", F_OK) != 0);
+    assert(qcore_checkpoint_restore(&resumed, CKPT_PATH) == 0);
+    assert(same_state(&resumed, &part));
+    release_system(&part);
+    printf("  field restored as %s block, launder step %llu\n",
+           resumed.field.kind == FIELD_BLOCK_MMAP ? "mmap" : "heap",
+           (unsigned long long)resumed.launder.step_count);
+
+    for (int i = 1200; i < 3000; i++) solve_step(&resumed, 0.05f);
+    assert(same_state(&resumed, &full));
+    printf("  t=%.2f stability %.4f rms %.6f on both runs\n",
+           full.time, full.stability, full.launder.current_rms);
+    release_system(&full);
+    printf("PASS: Checkpoint covers the whole SystemState.\n");
+
+    printf("[TEST] Resume mid-period under a decimated diagnostic schedule...\n");
+    SystemState dec_full, dec_part, dec_back;
+    memset(&dec_full, 0, sizeof(dec_full));
+    memset(&dec_part, 0, sizeof(dec_part));
+    memset(&dec_back, 0, sizeof(dec_back));
+    assert(init_system_dim(&dec_full, 16) == 0);
+    assert(init_system_dim(&dec_part, 16) == 0);
+    for (int g = 0; g < DIAG_GROUPS; g++) {
+        set_system_diagnostics(&dec_full, g, 7);
+        set_system_diagnostics(&dec_part, g, 7);
+    }
+    set_system_diagnostics(&dec_full, DIAG_BUS, DIAG_LAZY);
+    set_system_diagnostics(&dec_part, DIAG_BUS, DIAG_LAZY);
+    for (int i = 0; i < 2000; i++) solve_step(&dec_full, 0.05f);
+    for (int i = 0; i < 1203; i++) solve_step(&dec_part, 0.05f);   // 1203 = 7 * 171 + 6
+    assert(dec_part.observe.pending[DIAG_LASALLE] == 6);
+    assert(qcore_checkpoint_save(&dec_part, CKPT_PATH) == 0);
+    assert(qcore_checkpoint_restore(&dec_back, CKPT_PATH) == 0);
+    assert(same_state(&dec_back, &dec_part));
+    for (int i = 1203; i < 2000; i++) solve_step(&dec_back, 0.05f);
+    assert(same_state(&dec_back, &dec_full));
+    assert(dec_back.lyapunov_dot == dec_full.lyapunov_dot);
+    release_system(&dec_full);
+    release_system(&dec_part);
+    release_system(&dec_back);
+    printf("PASS: Decimation phase and dV/dt window survive the resume.\n");
+
+    printf("[TEST] Restore into an uninitialised state...\n");
+    SystemState junk;
+    memset(&junk, 0xA5, sizeof(junk));
+    assert(qcore_checkpoint_save(&resumed, CKPT_PATH) == 0);
+    assert(qcore_checkpoint_restore(&junk, CKPT_PATH) == 0);
+    assert(junk.integrator == INTEGRATOR_EULER && junk.osc == NULL);
+    assert(junk.executor.parallel_for == NULL && junk.executor.bus_report == NULL);
+    assert(junk.stability == resumed.stability && junk.launder.step_count == resumed.launder.step_count);
+    solve_step(&junk, 0.05f);   // Steps with the defaults, no garbage read
+    release_system(&junk);
+    printf("PASS: Run settings come back at their defaults.\n");
+
+    printf("[TEST] Interval ticks and atomic replacement...\n");
+    int written = 0;
+    for (int i = 0; i < 250; i++) {
+        solve_step(&resumed, 0.05f);
+        int rc = qcore_checkpoint_tick(&resumed, CKPT_PATH, 100);
+        assert(rc >= 0);
+        written += rc;
+    }
+    assert(written == 2);   // Steps 3001..3250 cross 3100 and 3200
+    SystemState latest;
+    memset(&latest, 0, sizeof(latest));
+    assert(qcore_checkpoint_restore(&latest, CKPT_PATH) == 0);
+    assert(latest.launder.step_count == 3200);
+    release_system(&latest);
+    // A save that cannot create its temp file leaves the old checkpoint alone
+    assert(qcore_checkpoint_save(&resumed, "no_such_dir/ckpt.bin") == -1);
+    printf("PASS: %d checkpoints written, last at step 3200.\n", written);
+
+    printf("[TEST] Corrupt, foreign and truncated files are rejected...\n");
+    assert(qcore_checkpoint_save(&resumed, CKPT_PATH) == 0);
+    SystemState bad;
+    memset(&bad, 0, sizeof(bad));
+    unsigned char flip = 0x5a;
+    patch_file((long)sizeof(CheckpointHeader) + 3, &flip, 1);     // Scalar record
+    assert(qcore_checkpoint_restore(&bad, CKPT_PATH) == -1);
+
+    assert(qcore_checkpoint_save(&resumed, CKPT_PATH) == 0);
+    uint32_t version = QCORE_CKPT_VERSION + 1;
+    patch_file((long)offsetof(CheckpointHeader, version), &version, sizeof(version));
+    assert(qcore_checkpoint_restore(&bad, CKPT_PATH) == -1);
+
+    assert(qcore_checkpoint_save(&resumed, CKPT_PATH) == 0);
+    assert(truncate(CKPT_PATH, QCORE_CKPT_ALIGN + 100) == 0);
+    assert(qcore_checkpoint_restore(&bad, CKPT_PATH) == -1);
+    assert(qcore_checkpoint_restore(&bad, "does_not_exist.bin") == -1);
+    release_system(&resumed);
+    printf("PASS: Only intact checkpoints of this version load.\n");
+
+    printf("[BENCH] 1024x1024 save / restore:\n");
+    SystemState big, back;
+    memset(&big, 0, sizeof(big));
+    memset(&back, 0, sizeof(back));
+    assert(init_system_dim(&big, 1024) == 0);
+    solve_step(&big, 0.05f);
+    double t0 = now_sec();
+    assert(qcore_checkpoint_save(&big, CKPT_PATH) == 0);
+    double t1 = now_sec();
+    assert(qcore_checkpoint_restore(&back, CKPT_PATH) == 0);
+    double t2 = now_sec();
+    solve_step(&back, 0.05f);   // First step faults the mapped pages in
+    double t3 = now_sec();
+    solve_step(&big, 0.05f);
+    assert(same_state(&back, &big));
+    printf("  save %.2f ms (fsync'd), restore %.3f ms, first step after restore %.2f ms\n",
+           (t1 - t0) * 1e3, (t2 - t1) * 1e3, (t3 - t2) * 1e3);
+    release_system(&big);
+    release_system(&back);
+    unlink(CKPT_PATH);
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
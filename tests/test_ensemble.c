@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "../kernel/qcore_ensemble.h"
+#include "../kernel/qcore_torus_simd.h"
+
+#define MEMBERS 1000
+#define STEPS 2000
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Spread the members across the control space the what-if runs explore
+static void perturb(SystemState *s, int m) {
+    s->shear_flow = 10.0f - (float)(m % 17) * 0.6f;
+    s->launder.kp = 0.001f * (1.0f + (float)(m % 5));
+    s->audio_energy = (m % 7 == 0) ? 0.6f : 0.01f * (float)(m % 3);
+    s->audio_coherence = (m % 11 == 0) ? 0.8f : 0.0f;
+    if (m % 13 == 0) s->time = 0.37f; // A few members run on their own clock
+}
+
+// Scalars and bus byte for byte, the torus by content (each state owns its buffers)
+static int same_state(const SystemState *a, const SystemState *b) {
+    SystemState tmp;
+    memcpy(&tmp, a, sizeof(SystemState));
+    tmp.phi_re = b->phi_re;
+    tmp.phi_im = b->phi_im;
+    tmp.row_sums = b->row_sums;
+    memcpy(&tmp.field, &b->field, sizeof(FieldBlock));
+    if (memcmp(&tmp, b, sizeof(SystemState)) != 0) return 0;
+    size_t bytes = (size_t)a->torus_dim * a->torus_dim * sizeof(float);
+    return memcmp(a->phi_re, b->phi_re, bytes) == 0 &&
+           memcmp(a->phi_im, b->phi_im, bytes) == 0;
+}
+
+int main() {
+    static SystemState ref[MEMBERS];
+    EnsembleState ens;
+
+    // Default dispatch: the batch reduction follows the detected ISA's lanes
+    printf("[TEST] Initializing ensemble of %d members (torus ISA %s)...\n",
+           MEMBERS, torus_isa_name(torus_isa_active()));
+    assert(ensemble_init(&ens, MEMBERS, TORUS_DIM) == 0);
+    for (int m = 0; m < MEMBERS; m++) {
+        memset(&ref[m], 0, sizeof(SystemState));
+        assert(init_system(&ref[m]) == 0);
+        perturb(&ref[m], m);
+        assert(ensemble_load(&ens, m, &ref[m]) == 0);
+    }
+
+    SystemState out;
+    memset(&out, 0, sizeof(SystemState)); // Zero padding, like ref[]
+    assert(init_system(&out) == 0);
+
+    printf("[TEST] Running %d steps, batch vs solve_step...\n", STEPS);
+    float dt = 0.05f;
+    double t_batch = 0.0, t_scalar = 0.0;
+    for (int step = 0; step < STEPS; step++) {
+        double t0 = now_sec();
+        solve_step_batch(&ens, dt);
+        double t1 = now_sec();
+        for (int m = 0; m < MEMBERS; m++) solve_step(&ref[m], dt);
+        double t2 = now_sec();
+        t_batch += t1 - t0;
+        t_scalar += t2 - t1;
+
+        if (step % 500 == 0 || step == STEPS - 1) {
+            for (int m = 0; m < MEMBERS; m++) {
+                assert(ensemble_store(&ens, m, &out) == 0);
+                if (!same_state(&out, &ref[m])) {
+                    printf("FAIL: member %d diverged at step %d (stability %.9g vs %.9g)\n",
+                           m, step, out.stability, ref[m].stability);
+                    return 1;
+                }
+            }
+            printf("Step %d: member 0 Stability = %.2f, member 16 Stability = %.2f\n",
+                   step, ens.stability[0], ens.stability[16]);
+        }
+    }
+    printf("PASS: All %d members match solve_step bit for bit.\n", MEMBERS);
+
+    double work = (double)MEMBERS * STEPS;
+    printf("[BENCH] scalar solve_step : %.3e members*steps/s\n", work / t_scalar);
+    printf("[BENCH] solve_step_batch  : %.3e members*steps/s (%.2fx)\n",
+           work / t_batch, t_scalar / t_batch);
+
+    printf("[TEST] Ensemble rejects members of a different resolution...\n");
+    SystemState wide;
+    assert(init_system_dim(&wide, 2 * TORUS_DIM) == 0);
+    assert(ensemble_load(&ens, 0, &wide) == -1);
+    assert(ensemble_store(&ens, 0, &wide) == -1);
+    release_system(&wide);
+    printf("PASS: Mismatched torus_dim refused.\n");
+
+    printf("[TEST] Every torus ISA, odd grid (vector tails), batch vs solve_step...\n");
+    TorusIsa best = torus_isa_detect();
+    for (int isa = TORUS_ISA_SCALAR; isa <= (int)best; isa++) {
+        enum { SMALL = 48, ODD_DIM = 5 };
+        assert(torus_isa_select((TorusIsa)isa) == 0);
+        EnsembleState small;
+        assert(ensemble_init(&small, SMALL, ODD_DIM) == 0);
+        SystemState solo[SMALL], back;
+        memset(&back, 0, sizeof(back));
+        assert(init_system_dim(&back, ODD_DIM) == 0);
+        for (int m = 0; m < SMALL; m++) {
+            memset(&solo[m], 0, sizeof(SystemState));
+            assert(init_system_dim(&solo[m], ODD_DIM) == 0);
+            perturb(&solo[m], m);
+            assert(ensemble_load(&small, m, &solo[m]) == 0);
+        }
+        for (int step = 0; step < 300; step++) {
+            solve_step_batch(&small, dt);
+            for (int m = 0; m < SMALL; m++) solve_step(&solo[m], dt);
+        }
+        for (int m = 0; m < SMALL; m++) {
+            assert(ensemble_store(&small, m, &back) == 0);
+            assert(same_state(&back, &solo[m]));
+            release_system(&solo[m]);
+        }
+        release_system(&back);
+        ensemble_free(&small);
+        printf("  %-6s: %d members bit-identical after 300 steps\n", torus_isa_name((TorusIsa)isa), SMALL);
+    }
+    assert(torus_isa_select(best) == 0);
+    printf("PASS: The batch sync clock rounds like each ISA's kernel.\n");
+
+    printf("[TEST] Ensemble rejects settings the batch kernel does not run...\n");
+    SystemState odd;
+    memset(&odd, 0, sizeof(odd));
+    assert(init_system(&odd) == 0);
+    odd.integrator = INTEGRATOR_STRANG;
+    assert(ensemble_load(&ens, 0, &odd) == -1);
+    odd.integrator = INTEGRATOR_EULER;
+    QcoreOscBank bank;
+    assert(init_system_osc(&bank, 0) == 0);
+    odd.osc = &bank;
+    assert(ensemble_load(&ens, 0, &odd) == -1);
+    odd.osc = NULL;
+    const int32_t schedules[] = {DIAG_OFF, DIAG_LAZY, 5};
+    for (int k = 0; k < 3; k++) {
+        set_system_diagnostics(&odd, DIAG_LASALLE, schedules[k]);
+        assert(ensemble_load(&ens, 0, &odd) == -1);
+    }
+    set_system_diagnostics(&odd, DIAG_LASALLE, 1);
+    assert(ensemble_load(&ens, 0, &odd) == 0);
+    odd.observe.pending[DIAG_NODAL] = 3;
+    odd.observe.elapsed[DIAG_NODAL] = 0.15f;
+    assert(ensemble_store(&ens, 0, &odd) == 0);
+    for (int g = 0; g < DIAG_GROUPS; g++) {
+        assert(odd.observe.period[g] == 1 && odd.observe.pending[g] == 0 && odd.observe.elapsed[g] == 0.0f);
+    }
+    qcore_osc_release(&bank);
+    release_system(&odd);
+    printf("PASS: Strang, phase-bank and scheduled-diagnostic states refused.\n");
+
+    release_system(&out);
+    for (int m = 0; m < MEMBERS; m++) release_system(&ref[m]);
+    ensemble_free(&ens);
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "../kernel/qcore_fb.h"
+#include "../kernel/qcore_view.h"
+
+#define W 64
+#define H 48
+
+static uint32_t pixels[W * H];
+static QcoreFramebuffer fb = {pixels, W, H, W};
+
+static int count(uint32_t color) {
+    int n = 0;
+    for (int k = 0; k < W * H; k++) n += (pixels[k] == color);
+    return n;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main() {
+    printf("[TEST] Rectangles follow Xlib geometry and clip...\n");
+    qcore_fb_clear(&fb, 0);
+    assert(count(0) == W * H);
+    qcore_fb_fill_rect(&fb, 2, 3, 10, 4, 1);
+    assert(count(1) == 40 && pixels[3 * W + 2] == 1 && pixels[6 * W + 11] == 1 && pixels[7 * W + 11] == 0);
+    qcore_fb_fill_rect(&fb, -5, -5, 1000, 1000, 2);          // Clipped to the buffer
+    assert(count(2) == W * H);
+    qcore_fb_clear(&fb, 0);
+    qcore_fb_draw_rect(&fb, 10, 10, 20, 5, 3);                // (w+1) x (h+1) outline
+    assert(count(3) == 2 * 21 + 2 * 4);
+    assert(pixels[10 * W + 30] == 3 && pixels[15 * W + 10] == 3 && pixels[12 * W + 20] == 0);
+    qcore_fb_fill_rect(&fb, 0, 0, 100, -3, 4);                // Empty boxes draw nothing
+    assert(count(4) == 0);
+    printf("PASS: Fill, outline, clipping.\n");
+
+    printf("[TEST] Discs stay in their box and are symmetric...\n");
+    for (int size = 1; size <= 12; size++) {
+        qcore_fb_clear(&fb, 0);
+        qcore_fb_fill_disc(&fb, 20, 20, size, 5);
+        int n = count(5);
+        assert(n > 0 && n <= size * size);
+        for (int y = 0; y < H; y++) {
+            for (int x = 0; x < W; x++) {
+                if (pixels[y * W + x] != 5) continue;
+                assert(x >= 20 && x < 20 + size && y >= 20 && y < 20 + size);
+                assert(pixels[y * W + (39 + size - x)] == 5);          // Mirror in x
+                assert(pixels[(39 + size - y) * W + x] == 5);          // Mirror in y
+            }
+        }
+    }
+    qcore_fb_clear(&fb, 0);
+    qcore_fb_fill_disc(&fb, -4, -4, 10, 5);                   // Partly off-screen
+    assert(count(5) > 0 && pixels[0] == 5);
+    printf("PASS: size 1..12, clipped at the origin.\n");
+
+    printf("[TEST] Text: baseline, advance, unprintables...\n");
+    qcore_fb_clear(&fb, 0);
+    assert(qcore_fb_draw_text(&fb, 4, 20, "AB", 6) == 2 * QCORE_FB_GLYPH_W);
+    // 'A' row 0 is 0x0C (columns 2-3), 7 rows above the baseline
+    assert(pixels[13 * W + 6] == 6 && pixels[13 * W + 7] == 6 && pixels[13 * W + 5] == 0);
+    assert(pixels[12 * W + 6] == 0);
+    int lit = count(6);
+    qcore_fb_draw_char(&fb, 30, 20, '\n', 6);
+    qcore_fb_draw_char(&fb, 30, 20, (char)0xC3, 6);
+    qcore_fb_draw_text(&fb, -7, 3, "@@@", 6);                 // Clipped on both axes
+    qcore_fb_draw_text(&fb, W - 3, H + 2, "gy", 6);
+    assert(count(6) > lit);
+    printf("PASS: Glyphs land on the baseline and clip.\n");
+
+    printf("[TEST] Full qcore_sim frame at 256x256...\n");
+    static uint32_t frame[800 * 600];
+    QcoreFramebuffer screen = {frame, 800, 600, 800};
+    SystemState state;
+    memset(&state, 0, sizeof(state));
+    assert(init_system_dim(&state, 256) == 0);
+    for (int k = 0; k < 256 * 256; k++) {                     // Every cell bright
+        state.phi_re[k] = 1.0f;
+        state.phi_im[k] = 0.0f;
+    }
+    state.solenoid_filter = 1.0f;
+    state.breathing_state = 1.0f;                             // Largest points
+    ViewStats stats = {60.0, 60.0, 1.0, "XShm"};
+    qcore_view_render(&screen, &state, &stats);
+    int torus_px = 0;
+    for (int k = 0; k < 800 * 600; k++) torus_px += (frame[k] == 0x22d3ee || frame[k] == 0x3b82f6);
+    assert(torus_px > 10000);
+
+    const int frames = 60;
+    double t0 = now_sec();
+    for (int f = 0; f < frames; f++) {
+        state.global_identity += 0.01f;
+        qcore_view_render(&screen, &state, &stats);
+    }
+    double ms = (now_sec() - t0) / frames * 1e3;
+    printf("  %.2f ms per frame (%d lit pixels, 60 fps budget 16.7 ms)\n", ms, torus_px);
+    release_system(&state);
+    printf("PASS: Frame rasterized.\n");
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
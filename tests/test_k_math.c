@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <assert.h>
+#include <math.h>
+#include <time.h>
+#include "../kernel/k_math.h"
+
+#define SAMPLES 200000
+#define BENCH_N 4096
+#define BENCH_REPS 2000
+
+typedef float (*UnaryFn)(float);
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Error in units of the last place of the correctly rounded float result
+static double ulp_err(float got, double want) {
+    float w = (float)want;
+    if (w == 0.0f) return fabs((double)got - want) / ldexp(1.0, -149);
+    int e;
+    frexpf(w, &e);
+    return fabs((double)got - want) / ldexp(1.0, e - 24);
+}
+
+static double dsin(double x) { return sin(x); }
+static double dcos(double x) { return cos(x); }
+static double dexp(double x) { return exp(x); }
+static double dsqrt(double x) { return sqrt(x); }
+
+typedef struct {
+    double max_ulp;
+    double max_abs;
+} ErrStat;
+
+static ErrStat measure(UnaryFn f, double (*ref)(double), float lo, float hi, int logscale) {
+    ErrStat st = {0.0, 0.0};
+    for (int i = 0; i <= SAMPLES; i++) {
+        double u = (double)i / SAMPLES;
+        float x = logscale ? (float)((double)lo * pow((double)hi / (double)lo, u)) : (float)(lo + (hi - lo) * u);
+        double want = ref((double)x);
+        float got = f(x);
+        double ue = ulp_err(got, want);
+        double ae = fabs((double)got - want);
+        if (ue > st.max_ulp) st.max_ulp = ue;
+        if (ae > st.max_abs) st.max_abs = ae;
+    }
+    return st;
+}
+
+static double bench(UnaryFn f, const float *x) {
+    volatile float sink = 0.0f;
+    double t0 = now_sec();
+    for (int r = 0; r < BENCH_REPS; r++) {
+        float acc = 0.0f;
+        for (int i = 0; i < BENCH_N; i++) acc += f(x[i]);
+        sink += acc;
+    }
+    (void)sink;
+    return (now_sec() - t0) * 1e9 / ((double)BENCH_REPS * BENCH_N);
+}
+
+static float libm_sin(float x) { return sinf(x); }
+static float libm_cos(float x) { return cosf(x); }
+static float libm_exp(float x) { return expf(x); }
+static float libm_sqrt(float x) { return sqrtf(x); }
+
+int main() {
+    printf("[TEST] Accuracy against libm (double reference)...\n");
+    struct {
+        const char *name;
+        UnaryFn acc, fast, libm;
+        double (*ref)(double);
+        float lo, hi;
+        int logscale;
+        double ulp_bound;   // accurate tier
+        double abs_bound;   // fast tier
+    } cases[] = {
+        {"sin  [-2pi,2pi]", k_sin_accurate, k_sin_fast, libm_sin, dsin, -6.3f, 6.3f, 0, 2.0, 2e-5},
+        {"cos  [-2pi,2pi]", k_cos_accurate, k_cos_fast, libm_cos, dcos, -6.3f, 6.3f, 0, 2.0, 2e-5},
+        {"sin  |x|<8192  ", k_sin_accurate, k_sin_fast, libm_sin, dsin, -K_TRIG_RANGE_FAST, K_TRIG_RANGE_FAST, 0, 2.0, 2e-5},
+        {"cos  |x|<8192  ", k_cos_accurate, k_cos_fast, libm_cos, dcos, -K_TRIG_RANGE_FAST, K_TRIG_RANGE_FAST, 0, 2.0, 2e-5},
+        {"sin  |x|<2^20  ", k_sin_accurate, k_sin_fast, libm_sin, dsin, -K_TRIG_RANGE, K_TRIG_RANGE, 0, 2.0, 0.0},
+        {"cos  |x|<2^20  ", k_cos_accurate, k_cos_fast, libm_cos, dcos, -K_TRIG_RANGE, K_TRIG_RANGE, 0, 2.0, 0.0},
+        {"exp  [-87,88]  ", k_exp_accurate, k_exp_fast, libm_exp, dexp, -87.0f, 88.0f, 0, 2.0, 0.0},
+        {"sqrt [1e-30,1e30]", k_sqrt_accurate, k_sqrt_fast, libm_sqrt, dsqrt, 1e-30f, 1e30f, 1, 0.5, 0.0},
+    };
+    int n_cases = (int)(sizeof(cases) / sizeof(cases[0]));
+
+    for (int c = 0; c < n_cases; c++) {
+        ErrStat a = measure(cases[c].acc, cases[c].ref, cases[c].lo, cases[c].hi, cases[c].logscale);
+        ErrStat f = measure(cases[c].fast, cases[c].ref, cases[c].lo, cases[c].hi, cases[c].logscale);
+        ErrStat l = measure(cases[c].libm, cases[c].ref, cases[c].lo, cases[c].hi, cases[c].logscale);
+        printf("  %-17s accurate %6.2f ulp (abs %.2e) | fast %10.1f ulp (abs %.2e) | libm %.2f ulp\n",
+               cases[c].name, a.max_ulp, a.max_abs, f.max_ulp, f.max_abs, l.max_ulp);
+        assert(a.max_ulp <= cases[c].ulp_bound);
+        if (cases[c].abs_bound > 0.0) assert(f.max_abs <= cases[c].abs_bound);
+    }
+    // Relative error where the fast tier has no absolute bound
+    ErrStat fe = measure(k_exp_fast, dexp, -1.0f, 1.0f, 0);
+    ErrStat fs = measure(k_sqrt_fast, dsqrt, 1e-30f, 1e30f, 1);
+    printf("  fast exp [-1,1] %.1f ulp, fast sqrt %.1f ulp\n", fe.max_ulp, fs.max_ulp);
+    assert(fe.max_ulp < 128.0);
+    assert(fs.max_ulp < 64.0);
+    printf("PASS: Both tiers within their error budgets.\n");
+
+    printf("[TEST] Edge cases...\n");
+    assert(k_exp(0.0f) == 1.0f);
+    assert(isinf(k_exp(100.0f)) && k_exp(-100.0f) == 0.0f);
+    assert(isnan(k_exp(NAN)) && isnan(k_sin(INFINITY)) && isnan(k_cos(NAN)));
+    assert(k_sqrt(-1.0f) == 0.0f && k_sqrt(0.0f) == 0.0f && k_sqrt(4.0f) == 2.0f);
+    float s, c;
+    k_sincos(1.25f, &s, &c);
+    assert(s == k_sin(1.25f) && c == k_cos(1.25f));
+    float m = k_mod_2pi(-1.0f);
+    assert(m >= 0.0f && fabsf(m - (float)(2.0 * M_PI - 1.0)) < 1e-6f);
+    printf("PASS: Edge cases handled.\n");
+
+    printf("[BENCH] ns/call (%d args x %d reps):\n", BENCH_N, BENCH_REPS);
+    static float small[BENCH_N], large[BENCH_N], ex[BENCH_N], pos[BENCH_N];
+    for (int i = 0; i < BENCH_N; i++) {
+        small[i] = -3.0f + 6.0f * (float)i / BENCH_N;
+        large[i] = 10000.0f + 3.0f * (float)i;   // Long-run simulation times
+        ex[i] = -20.0f + 40.0f * (float)i / BENCH_N;
+        pos[i] = 0.001f + 1000.0f * (float)i / BENCH_N;
+    }
+    printf("  sin |x|<3     accurate %5.2f  fast %5.2f  libm %5.2f\n",
+           bench(k_sin_accurate, small), bench(k_sin_fast, small), bench(libm_sin, small));
+    printf("  sin x~1e4     accurate %5.2f  fast %5.2f  libm %5.2f\n",
+           bench(k_sin_accurate, large), bench(k_sin_fast, large), bench(libm_sin, large));
+    printf("  cos |x|<3     accurate %5.2f  fast %5.2f  libm %5.2f\n",
+           bench(k_cos_accurate, small), bench(k_cos_fast, small), bench(libm_cos, small));
+    printf("  exp [-20,20]  accurate %5.2f  fast %5.2f  libm %5.2f\n",
+           bench(k_exp_accurate, ex), bench(k_exp_fast, ex), bench(libm_exp, ex));
+    printf("  sqrt          accurate %5.2f  fast %5.2f  libm %5.2f\n",
+           bench(k_sqrt_accurate, pos), bench(k_sqrt_fast, pos), bench(libm_sqrt, pos));
+
+    static float sv[BENCH_N], cv[BENCH_N];
+    double t0 = now_sec();
+    for (int r = 0; r < BENCH_REPS; r++) k_sincos_array(large, sv, cv, BENCH_N);
+    printf("  k_sincos_array x~1e4: %.2f ns/element\n",
+           (now_sec() - t0) * 1e9 / ((double)BENCH_REPS * BENCH_N));
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
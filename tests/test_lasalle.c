@@ -4,7 +4,7 @@
 
 int main() {
     SystemState state;
-    init_system(&state);
+    assert(init_system(&state) == 0);
 
     printf("[LASALLE VALIDATION] Beginning formal stability proof...\n");
     printf("Initial V: %.6f, Stability: %.2f\n", state.lyapunov_v, state.stability);
@@ -37,5 +37,6 @@ int main() {
     printf("PASS: Maximal Invariant Set (Golden Ratio) reached and sustained!\n");
 
     printf("[LASALLE VALIDATION] FORMAL STABILITY VERIFIED.\n");
+    release_system(&state);
     return 0;
 }
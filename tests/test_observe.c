@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <time.h>
+#include "../kernel/qcore_snapshot.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void set_all(SystemState *s, int32_t period) {
+    for (int g = 0; g < DIAG_GROUPS; g++) set_system_diagnostics(s, g, period);
+}
+
+static int same_core(const SystemState *a, const SystemState *b) {
+    size_t bytes = (size_t)a->torus_dim * (size_t)a->torus_dim * sizeof(float);
+    return memcmp(a->phi_re, b->phi_re, bytes) == 0 && memcmp(a->phi_im, b->phi_im, bytes) == 0 &&
+           a->stability == b->stability && a->temperature == b->temperature &&
+           a->sync_clock_c == b->sync_clock_c && a->launder.current_rms == b->launder.current_rms;
+}
+
+// Steps per second of solve_step on an N x N torus with every group at `period`
+static double steps_per_sec(int dim, int32_t period, int steps) {
+    SystemState s;
+    memset(&s, 0, sizeof(s));
+    assert(init_system_dim(&s, dim) == 0);
+    set_all(&s, period);
+    double t0 = now_sec();
+    for (int i = 0; i < steps; i++) solve_step(&s, 0.05f);
+    double rate = steps / (now_sec() - t0);
+    release_system(&s);
+    return rate;
+}
+
+int main() {
+    SystemState ref, s;
+    memset(&ref, 0, sizeof(ref));
+    memset(&s, 0, sizeof(s));
+
+    printf("[TEST] Defaults and argument checks...\n");
+    assert(init_system(&s) == 0);
+    for (int g = 0; g < DIAG_GROUPS; g++) assert(s.observe.period[g] == 1);
+    set_system_diagnostics(&s, DIAG_GROUPS, DIAG_OFF);
+    set_system_diagnostics(&s, DIAG_ALPHA, -2);
+    for (int g = 0; g < DIAG_GROUPS; g++) assert(s.observe.period[g] == 1);
+    release_system(&s);
+    printf("PASS: Every group, every step by default.\n");
+
+    printf("[TEST] Diagnostics never change the dynamics...\n");
+    const int32_t modes[] = {DIAG_OFF, DIAG_LAZY, 7};
+    for (int m = 0; m < 3; m++) {
+        assert(init_system(&ref) == 0);
+        assert(init_system(&s) == 0);
+        set_all(&s, modes[m]);
+        for (int step = 0; step < 3000; step++) {
+            solve_step(&ref, 0.05f);
+            solve_step(&s, 0.05f);
+        }
+        assert(same_core(&ref, &s));
+        release_system(&ref);
+        release_system(&s);
+    }
+    printf("PASS: Bit-identical core state with groups off, lazy or decimated.\n");
+
+    printf("[TEST] Off freezes, lazy waits for system_observe()...\n");
+    assert(init_system(&ref) == 0);
+    assert(init_system(&s) == 0);
+    set_system_diagnostics(&s, DIAG_NODAL, DIAG_OFF);
+    set_system_diagnostics(&s, DIAG_LASALLE, DIAG_LAZY);
+    set_system_diagnostics(&s, DIAG_BUS, DIAG_LAZY);
+    for (int step = 0; step < 2000; step++) {
+        solve_step(&ref, 0.05f);
+        solve_step(&s, 0.05f);
+        assert(s.vortex_z == 0.0f && s.lyapunov_v == 0.0f && !s.is_lasalle_locked);
+        assert(s.l2_error == ref.l2_error);   // Alpha still every step
+    }
+    assert(s.observe.pending[DIAG_LASALLE] == 2000 && s.observe.pending[DIAG_NODAL] == 0);
+    system_observe(&s);
+    // V and the lock flag depend on the current state only; a lazy read
+    // sees rho after the step's clamp to [0, 100], the step saw it before
+    assert(s.is_lasalle_locked == ref.is_lasalle_locked);
+    assert(fabsf(s.lyapunov_v - ref.lyapunov_v) < 0.05f);
+    for (int i = 0; i < 4; i++) assert(fabsf(s.bus.core_sync[i] - ref.bus.core_sync[i]) < 1e-2f);
+    assert(s.vortex_z == 0.0f && s.observe.pending[DIAG_LASALLE] == 0);
+    release_system(&ref);
+    release_system(&s);
+    printf("PASS: Lazy groups match the every-step values when read.\n");
+
+    printf("[TEST] Decimated groups match the every-step values...\n");
+    const int32_t periods[] = {2, 10, 50, DIAG_LAZY};
+    for (int p = 0; p < 4; p++) {
+        assert(init_system(&ref) == 0);
+        assert(init_system(&s) == 0);
+        set_all(&s, periods[p]);
+        for (int step = 1; step <= 6000; step++) {
+            solve_step(&ref, 0.05f);
+            solve_step(&s, 0.05f);
+            // The l2_error EMA sees every step's sync clock
+            assert(s.l2_error == ref.l2_error);
+            if (periods[p] == DIAG_LAZY || step % periods[p]) continue;
+            // Every group just ran: the state-only values match exactly
+            assert(s.lyapunov_v == ref.lyapunov_v && s.vortex_z == ref.vortex_z);
+            assert(s.thermal_eff == ref.thermal_eff);
+            assert(s.is_lasalle_locked == ref.is_lasalle_locked);
+        }
+        release_system(&ref);
+        release_system(&s);
+    }
+
+    // Held input through solve_step_observe: with rho climbing linearly,
+    // dV/dt is the same slope whether taken every step or every 25
+    assert(init_system(&ref) == 0);
+    assert(init_system(&s) == 0);
+    set_system_diagnostics(&s, DIAG_LASALLE, 25);
+    ref.stability = s.stability = 60.0f;
+    for (int step = 1; step <= 2500; step++) {
+        ref.stability += 0.01f;
+        s.stability += 0.01f;
+        solve_step_observe(&ref, 0.05f);
+        solve_step_observe(&s, 0.05f);
+        if (step % 25 || step == 25) continue;
+        assert(fabsf(s.lyapunov_dot - ref.lyapunov_dot) <= 1e-2f * fabsf(ref.lyapunov_dot));
+    }
+    printf("  held input: dV/dt %.4f every 25 steps, %.4f every step\n",
+           s.lyapunov_dot, ref.lyapunov_dot);
+    release_system(&ref);
+    release_system(&s);
+    printf("PASS: Exact l2_error, state values and dV/dt under decimation.\n");
+
+    printf("[TEST] Publishing snapshots leaves the schedule alone...\n");
+    memset(&ref, 0, sizeof(ref));
+    memset(&s, 0, sizeof(s));
+    assert(init_system_dim(&ref, 16) == 0);
+    assert(init_system_dim(&s, 16) == 0);
+    set_all(&ref, 7);
+    set_all(&s, 7);
+    QcoreSnapshot snap;
+    assert(qcore_snapshot_init(&snap, &s) == 0);
+    int published = 0;
+    for (int step = 1; step <= 1000; step++) {
+        solve_step(&ref, 0.05f);
+        solve_step(&s, 0.05f);
+        if ((step * step) % 13 >= 4) continue;   // Irregular, like a reader's frame times
+        qcore_snapshot_publish(&snap, &s);
+        published++;
+        const SystemState *view = qcore_snapshot_read(&snap);
+        assert(view->observe.pending[DIAG_LASALLE] == 0);
+    }
+    assert(same_core(&s, &ref));
+    assert(s.lyapunov_dot == ref.lyapunov_dot && s.l2_error == ref.l2_error);
+    assert(memcmp(&s.observe, &ref.observe, sizeof(s.observe)) == 0);
+    qcore_snapshot_release(&snap);
+    release_system(&ref);
+    release_system(&s);
+    printf("PASS: %d publishes, same dV/dt as the unpublished run.\n", published);
+
+    printf("[BENCH] Steps per second, every diagnostic vs core dynamics only:\n");
+    const int dims[] = {8, 64};
+    for (int d = 0; d < 2; d++) {
+        int steps = dims[d] == 8 ? 200000 : 20000;
+        double all = steps_per_sec(dims[d], 1, steps);
+        double lazy = steps_per_sec(dims[d], DIAG_LAZY, steps);
+        double core = steps_per_sec(dims[d], DIAG_OFF, steps);
+        printf("  %3dx%-3d: all %.3g steps/s, lazy %.3g, core only %.3g (%.2fx)\n",
+               dims[d], dims[d], all, lazy, core, core / all);
+    }
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
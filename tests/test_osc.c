@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <time.h>
+#include "../kernel/qcore_metriplectic.h"
+
+#define MODES 4096
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main() {
+    QcoreOscBank bank;
+
+    printf("[TEST] Bank setup and direct re-anchoring...\n");
+    assert(qcore_osc_init(&bank, 0, 0) == -1);
+    assert(qcore_osc_init(&bank, 3, 0) == 0);
+    qcore_osc_set(&bank, 0, PI, 0.0f);
+    qcore_osc_set(&bank, 1, PI_PHI_CONST, 0.25f);
+    qcore_osc_set(&bank, 2, 40.0f, -1.0f);
+    qcore_osc_sync(&bank, 1.7f);
+    assert(qcore_osc_drift(&bank) < 1e-6f);
+    assert(fabsf(qcore_osc_cos(&bank, 1) - cosf(PI_PHI_CONST * 1.7f + 0.25f)) < 1e-5f);
+    assert(fabsf(qcore_osc_sin(&bank, 2) - sinf(40.0f * 1.7f - 1.0f)) < 1e-4f);
+
+    // A time the bank did not step to forces a direct sync
+    uint64_t syncs = bank.syncs;
+    qcore_osc_follow(&bank, 1.9f, 0.05f);
+    assert(bank.syncs == syncs + 1 && bank.steps == 0);
+    qcore_osc_follow(&bank, 1.9f + 0.05f, 0.05f);
+    assert(bank.syncs == syncs + 1 && bank.steps == 1);
+    // Midpoint values come from the half-step rotators
+    for (int k = 0; k < 3; k++) {
+        float mid = bank.omega[k] * (bank.t - 0.025f) + bank.phase[k];
+        assert(fabsf(qcore_osc_cos_mid(&bank, k) - cosf(mid)) < 1e-5f);
+    }
+    qcore_osc_release(&bank);
+    printf("PASS: Direct values, on-demand sync, midpoints.\n");
+
+    printf("[TEST] %d nodal modes: drift against direct evaluation...\n", MODES);
+    // Modes 1..MODES/2 of pi·m·t and PI_PHI·m·t (up to ~1e4 rad/s),
+    // amplitudes 1/m, 4096 steps of 0.05 on a float clock
+    static float amp[MODES], direct[MODES];
+    const uint32_t periods[] = {0, 1024, 256, 64};
+    float drift[4];
+    for (int p = 0; p < 4; p++) {
+        assert(qcore_osc_init(&bank, MODES, periods[p]) == 0);
+        for (int k = 0; k < MODES; k++) {
+            float m = (float)(k / 2 + 1);
+            qcore_osc_set(&bank, k, ((k & 1) ? PI_PHI_CONST : PI) * m, 0.0f);
+            amp[k] = 1.0f / m;
+        }
+        float t = 0.0f, worst = 0.0f, sum_err = 0.0f;
+        qcore_osc_sync(&bank, t);
+        for (int step = 1; step <= 4096; step++) {
+            t += 0.05f;
+            qcore_osc_follow(&bank, t, 0.05f);
+            if (step % 16 != 15) continue;
+            float d = qcore_osc_drift(&bank);
+            if (d > worst) worst = d;
+            if (step % 256 != 255) continue;
+            double ref = 0.0;
+            for (int k = 0; k < MODES; k++) ref += amp[k] * cos((double)bank.omega[k] * (double)t);
+            float es = (float)fabs(qcore_osc_sum(&bank, 0, MODES, amp) - ref);
+            if (es > sum_err) sum_err = es;
+        }
+        drift[p] = worst;
+        printf("  resync %4u: drift %.2e, weighted sum error %.2e (%llu syncs, %llu rotator builds)\n",
+               periods[p], worst, sum_err, (unsigned long long)bank.syncs,
+               (unsigned long long)bank.rebuilds);
+        assert(worst < 2e-3f && sum_err < 1e-3f);
+        assert(bank.renorms > 0);
+        // The clock's step changes at each power of two it crosses (t < 256)
+        assert(bank.rebuilds <= 16);
+        qcore_osc_release(&bank);
+    }
+    // Re-anchoring more often caps the drift lower
+    assert(drift[3] < drift[2] && drift[2] < drift[1] && drift[1] < drift[0]);
+    printf("PASS: Drift bounded by the resync period, even for high modes.\n");
+
+    printf("[TEST] solve_step with the bank tracks the direct path...\n");
+    SystemState a, b;
+    QcoreOscBank step_bank;
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    assert(init_system_osc(&step_bank, 256) == 0);
+    const QcoreIntegrator schemes[] = {INTEGRATOR_EULER, INTEGRATOR_STRANG};
+    for (int i = 0; i < 2; i++) {
+        assert(init_system(&a) == 0);
+        assert(init_system(&b) == 0);
+        a.integrator = b.integrator = schemes[i];
+        b.osc = &step_bank;
+        float worst_z = 0.0f;
+        int locks_a = 0, locks_b = 0;
+        for (int step = 0; step < 5000; step++) {
+            solve_step(&a, 0.05f);
+            solve_step(&b, 0.05f);
+            float dz = fabsf(a.vortex_z - b.vortex_z);
+            if (dz > worst_z) worst_z = dz;
+            if (a.is_lasalle_locked) locks_a++;
+            if (b.is_lasalle_locked) locks_b++;
+        }
+        printf("  %s: worst |d vortex_z| %.2e, stability %.3f vs %.3f, locked %d vs %d steps, drift %.2e\n",
+               i ? "strang" : "euler", worst_z, a.stability, b.stability, locks_a, locks_b,
+               qcore_osc_drift(&step_bank));
+        assert(worst_z < 1e-3f);
+        assert(fabsf(a.stability - b.stability) < 0.5f);
+        assert(fabsf(a.sync_clock_c - b.sync_clock_c) < 1e-3f);
+        assert(locks_b > 100 && qcore_osc_drift(&step_bank) < 1e-4f);
+        release_system(&a);
+        release_system(&b);
+    }
+
+    // Unattached, or attached but left behind, the step is bit-identical
+    assert(init_system(&a) == 0);
+    assert(init_system(&b) == 0);
+    b.osc = &step_bank;
+    for (int step = 0; step < 100; step++) {
+        solve_step(&a, 0.05f);
+        solve_step(&b, 0.05f);
+    }
+    b.osc = NULL;
+    copy_system(&a, &b);
+    for (int step = 0; step < 100; step++) {
+        solve_step(&a, 0.05f);
+        solve_step(&b, 0.05f);
+    }
+    assert(memcmp(a.phi_re, b.phi_re, TORUS_DIM * TORUS_DIM * sizeof(float)) == 0);
+    assert(a.stability == b.stability && a.vortex_z == b.vortex_z);
+    release_system(&a);
+    release_system(&b);
+    printf("PASS: Same statistics, same lock behaviour.\n");
+
+    printf("[BENCH] %d-mode sum per step, bank vs direct k_cos:\n", MODES);
+    assert(qcore_osc_init(&bank, MODES, 256) == 0);
+    for (int k = 0; k < MODES; k++) qcore_osc_set(&bank, k, PI * (float)(k + 1), 0.0f);
+    int steps = 2000;
+    float t = 0.0f;
+    volatile float sink = 0.0f;
+    double t0 = now_sec();
+    for (int step = 0; step < steps; step++) {
+        t += 0.05f;
+        qcore_osc_follow(&bank, t, 0.05f);
+        sink = qcore_osc_sum(&bank, 0, MODES, amp);
+    }
+    double bank_ns = (now_sec() - t0) * 1e9 / ((double)steps * MODES);
+    t = 0.0f;
+    t0 = now_sec();
+    for (int step = 0; step < steps; step++) {
+        t += 0.05f;
+        for (int k = 0; k < MODES; k++) direct[k] = bank.omega[k] * t;
+        k_cos_array(direct, direct, MODES);
+        float sum = 0.0f;
+        for (int k = 0; k < MODES; k++) sum += amp[k] * direct[k];
+        sink = sum;
+    }
+    double direct_ns = (now_sec() - t0) * 1e9 / ((double)steps * MODES);
+    (void)sink;
+    printf("  bank %.2f ns/mode, direct %.2f ns/mode (%.1fx)\n", bank_ns, direct_ns, direct_ns / bank_ns);
+    qcore_osc_release(&bank);
+    qcore_osc_release(&step_bank);
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
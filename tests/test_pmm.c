@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "../kernel/pmm.h"
+#include "../kernel/arena.h"
+
+#define MB (1024u * 1024u)
+#define KERNEL_END (0x100000u + 32u * PMM_FRAME)
+
+int main() {
+    printf("[TEST] Frame map from usable regions and reservations...\n");
+    pmm_reset();
+    assert(pmm_frames_total() == 0 && pmm_alloc_frames(1) == 0);
+    pmm_add_region(0x1800, 0x3000);                 // Only frames 2 and 3 lie wholly inside
+    assert(pmm_frames_total() == 2);
+    pmm_add_region(0x100000, 127u * MB);
+    pmm_add_region(0x100000, 127u * MB);            // Same region twice counts once
+    assert(pmm_frames_total() == 2 + 127u * 256u);
+    pmm_reserve(0, 0x100000);                       // Low memory
+    pmm_reserve(0x100000, KERNEL_END - 0x100000 - 1); // Partial last frame is reserved too
+    assert(pmm_frames_free() == 127u * 256u - 32u);
+    pmm_add_region(0x3FF00000, 2u * MB);            // Clipped at PMM_MAX_PHYS
+    assert(pmm_frames_total() == 2 + 127u * 256u + 256u);
+    printf("PASS: %u frames usable, %u free.\n", pmm_frames_total(), pmm_frames_free());
+
+    printf("[TEST] First-fit contiguous allocation...\n");
+    uint32_t before = pmm_frames_free();
+    uintptr_t a = pmm_alloc_frames(1);
+    uintptr_t b = pmm_alloc_frames(4);
+    assert(a == KERNEL_END && b == KERNEL_END + PMM_FRAME);
+    pmm_free_frames(a, 1);
+    assert(pmm_alloc_frames(1) == a);               // The hole is reused
+    assert(pmm_alloc_frames(2) == b + 4 * PMM_FRAME);
+    assert(pmm_frames_free() == before - 7);
+    pmm_free_frames(b, 4);
+    pmm_free_frames(a, 1);
+    pmm_free_frames(b + 4 * PMM_FRAME, 2);
+    assert(pmm_frames_free() == before);
+
+    pmm_reset();
+    pmm_add_region(1u * MB, 1u * MB);
+    pmm_add_region(3u * MB, 1u * MB);
+    assert(pmm_alloc_frames(300) == 0);             // 512 free, but no run of 300
+    assert(pmm_alloc_frames(256) == 1u * MB);
+    assert(pmm_alloc_frames(256) == 3u * MB);
+    assert(pmm_frames_free() == 0 && pmm_alloc_frames(1) == 0);
+    printf("PASS: Holes skipped, freed frames reused.\n");
+
+    printf("[TEST] Arena: alignment, zeroing, release, reset...\n");
+    static unsigned char buf[4096] __attribute__((aligned(64)));
+    memset(buf, 0xAA, sizeof(buf));
+    Arena arena;
+    arena_init_range(&arena, buf, sizeof(buf));
+    unsigned char *p = arena_alloc(&arena, 10, 1);
+    unsigned char *q = arena_alloc(&arena, 100, 64);
+    assert(p == buf && q == buf + 64);
+    for (int i = 0; i < 100; i++) assert(q[i] == 0);
+    assert(buf[10] == 0xAA);                        // Padding is left alone
+    assert(arena_used(&arena) == 164 && arena.allocs == 2);
+    arena_release(&arena, p, 10);                   // Not the newest: kept
+    assert(arena_used(&arena) == 164);
+    arena_release(&arena, q, 100);
+    assert(arena_used(&arena) == 64 && arena.allocs == 0);
+    assert(arena_alloc(&arena, 4096, 1) == NULL);
+    assert(arena_alloc(&arena, 4096 - 64, 1) == buf + 64 && arena_free(&arena) == 0);
+    arena_reset(&arena);
+    assert(arena_used(&arena) == 0 && arena_free(&arena) == sizeof(buf));
+    printf("PASS: Aligned, zeroed, newest-only release.\n");
+
+    printf("[TEST] Arena backed by PMM frames...\n");
+    pmm_reset();
+    pmm_add_region(2u * MB, 1u * MB);
+    Arena frames;
+    assert(arena_init_frames(&frames, 2u * MB) == -1);
+    assert(arena_init_frames(&frames, 5000) == 0);  // Rounded up to whole frames
+    assert(frames.base == 2u * MB && arena_free(&frames) == 2 * PMM_FRAME);
+    assert(pmm_frames_free() == 254);
+    printf("PASS: Arena takes a contiguous run.\n");
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
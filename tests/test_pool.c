@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+#include "../kernel/qcore_pool.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Scalars byte for byte, the torus by content (each state owns its buffers)
+static int same_state(const SystemState *a, const SystemState *b) {
+    SystemState tmp;
+    memcpy(&tmp, a, sizeof(SystemState));
+    tmp.phi_re = b->phi_re;
+    tmp.phi_im = b->phi_im;
+    tmp.row_sums = b->row_sums;
+    memcpy(&tmp.field, &b->field, sizeof(FieldBlock));
+    memcpy(&tmp.executor, &b->executor, sizeof(TorusExecutor));
+    if (memcmp(&tmp, b, sizeof(SystemState)) != 0) return 0;
+    size_t bytes = (size_t)a->torus_dim * a->torus_dim * sizeof(float);
+    return memcmp(a->phi_re, b->phi_re, bytes) == 0 &&
+           memcmp(a->phi_im, b->phi_im, bytes) == 0;
+}
+
+static void run_parallel(SystemState *s, int dim, int threads, int steps) {
+    memset(s, 0, sizeof(SystemState));
+    assert(init_system_dim(s, dim) == 0);
+    QcorePool *pool = qcore_pool_create(threads);
+    assert(pool && qcore_pool_threads(pool) == threads);
+    qcore_pool_attach(pool, s);
+    for (int i = 0; i < steps; i++) solve_step(s, 0.05f);
+    qcore_pool_attach(NULL, s);
+    qcore_pool_destroy(pool);
+}
+
+int main() {
+    int thread_counts[] = {1, 2, 3, 4, 7};
+    int dims[] = {8, 64, 257};
+
+    printf("[TEST] Parallel solve_step is bit-identical for any thread count...\n");
+    for (int d = 0; d < 3; d++) {
+        SystemState ref;
+        run_parallel(&ref, dims[d], 1, 300);
+        for (int t = 1; t < 5; t++) {
+            SystemState s;
+            run_parallel(&s, dims[d], thread_counts[t], 300);
+            if (!same_state(&s, &ref)) {
+                printf("FAIL: %dx%d with %d threads differs (c = %.9g vs %.9g)\n",
+                       dims[d], dims[d], thread_counts[t], s.sync_clock_c, ref.sync_clock_c);
+                return 1;
+            }
+            release_system(&s);
+        }
+        printf("  %3dx%-3d 1/2/3/4/7 threads agree, c = %.9g\n", dims[d], dims[d], ref.sync_clock_c);
+        release_system(&ref);
+    }
+    printf("PASS: Row-ordered reduction is independent of the split.\n");
+
+    printf("[TEST] Parallel step matches the serial path (cells exact, c within n*u)...\n");
+    SystemState a, b;
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    assert(init_system_dim(&a, 128) == 0);
+    assert(init_system_dim(&b, 128) == 0);
+    a.time = b.time = 3.0f; // Away from the On = 0 start so c is non-trivial
+    QcorePool *pool = qcore_pool_create(4);
+    qcore_pool_attach(pool, &b);
+    solve_step(&a, 0.05f);
+    solve_step(&b, 0.05f);
+    size_t bytes = 128 * 128 * sizeof(float);
+    assert(memcmp(a.phi_re, b.phi_re, bytes) == 0);
+    assert(memcmp(a.phi_im, b.phi_im, bytes) == 0);
+    float rel = fabsf(a.sync_clock_c - b.sync_clock_c) / fabsf(a.sync_clock_c);
+    printf("  serial c = %.9g, parallel c = %.9g (rel %.2g)\n", a.sync_clock_c, b.sync_clock_c, rel);
+    assert(rel <= 128.0f * 128.0f * FLT_EPSILON * 0.5f);
+    qcore_pool_destroy(pool);
+    release_system(&a);
+    release_system(&b);
+    printf("PASS: Parallel mode only reorders the reduction.\n");
+
+    int max_threads = qcore_pool_default_threads();
+    if (max_threads < 4) max_threads = 4;
+    printf("[BENCH] 1024x1024 solve_step scaling (%d online CPUs):\n", qcore_pool_default_threads());
+    double base = 0.0;
+    for (int t = 1; t <= max_threads; t *= 2) {
+        SystemState s;
+        memset(&s, 0, sizeof(s));
+        assert(init_system_dim(&s, 1024) == 0);
+        QcorePool *p = qcore_pool_create(t);
+        qcore_pool_attach(p, &s);
+        solve_step(&s, 0.05f); // Warm-up: fault in the pages
+        double t0 = now_sec();
+        for (int i = 0; i < 20; i++) solve_step(&s, 0.05f);
+        double rate = 20.0 / (now_sec() - t0);
+        if (t == 1) base = rate;
+        printf("  %2d threads: %8.1f steps/s (%.2fx)\n", t, rate, rate / base);
+        qcore_pool_destroy(p);
+        release_system(&s);
+    }
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
@@ -5,7 +5,7 @@
 
 int main() {
     SystemState state;
-    init_system(&state);
+    assert(init_system(&state) == 0);
 
     // Run a single step of the simulation
     solve_step(&state, 0.05f);
@@ -28,5 +28,6 @@ int main() {
 
     printf("Test PASSED.\n");
 
+    release_system(&state);
     return 0;
 }
@@ -4,7 +4,7 @@
 
 int main() {
     SystemState state;
-    init_system(&state);
+    assert(init_system(&state) == 0);
 
     printf("[PROTOCOL ALPHA] Initializing Taylor-Couette Benchmark...\n");
     state.shear_flow = 10.0f; // Force high rotation (Mach 10)
@@ -40,5 +40,6 @@ int main() {
     printf("PASS: Thermal Efficiency Superiority Verified.\n");
 
     printf("[PROTOCOL ALPHA] ALL BENCHMARKS PASSED\n");
+    release_system(&state);
     return 0;
 }
@@ -4,7 +4,7 @@
 
 int main() {
     SystemState state;
-    init_system(&state);
+    assert(init_system(&state) == 0);
 
     printf("[TEST] Initializing GoldenLaunder HAL Test...\n");
     assert(state.launder.target_phi == PHI);
@@ -35,6 +35,7 @@ int main() {
         return 1;
     }
 
+    release_system(&state);
     printf("ALL TESTS PASSED\n");
     return 0;
 }
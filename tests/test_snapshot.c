@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "../kernel/qcore_snapshot.h"
+#include "../kernel/qcore_runner.h"
+
+#define PUBLISH_N 20000
+
+typedef struct {
+    QcoreSnapshot *snap;
+    SystemState *src;
+    _Atomic int done;
+} Writer;
+
+// Every publication carries one value in time and in every Φ cell
+static void stamp(SystemState *s, float value) {
+    s->time = value;
+    for (int k = 0; k < s->torus_dim * s->torus_dim; k++) {
+        s->phi_re[k] = value;
+        s->phi_im[k] = -value;
+    }
+}
+
+static void *publish_all(void *p) {
+    Writer *w = (Writer *)p;
+    for (int n = 1; n <= PUBLISH_N; n++) {
+        stamp(w->src, (float)n);
+        qcore_snapshot_publish(w->snap, w->src);
+        if (n % 64 == 0) sched_yield();
+    }
+    atomic_store(&w->done, 1);
+    return NULL;
+}
+
+static void sleep_sec(double s) {
+    struct timespec ts = {(time_t)s, (long)((s - (double)(time_t)s) * 1e9)};
+    nanosleep(&ts, NULL);
+}
+
+int main() {
+    printf("[TEST] Triple buffer: reader sees the newest publication...\n");
+    SystemState src;
+    memset(&src, 0, sizeof(src));
+    assert(init_system_dim(&src, 8) == 0);
+    stamp(&src, 0.0f);
+    QcoreSnapshot snap;
+    assert(qcore_snapshot_init(&snap, &src) == 0);
+    assert(qcore_snapshot_read(&snap)->time == src.time);
+    assert(qcore_snapshot_consumed(&snap));
+
+    stamp(&src, 1.0f);
+    qcore_snapshot_publish(&snap, &src);
+    assert(!qcore_snapshot_consumed(&snap));
+    stamp(&src, 2.0f);
+    qcore_snapshot_publish(&snap, &src);       // Replaces the unread 1.0
+    const SystemState *seen = qcore_snapshot_read(&snap);
+    assert(seen->time == 2.0f && qcore_snapshot_consumed(&snap));
+    assert(qcore_snapshot_read(&snap) == seen);  // Nothing new: same slot
+    stamp(&src, 3.0f);
+    qcore_snapshot_publish(&snap, &src);
+    assert(seen->time == 2.0f);                  // Reader's slot untouched by the writer
+    assert(qcore_snapshot_read(&snap)->time == 3.0f);
+    assert(snap.published == 3);
+    printf("PASS: Latest wins, the front slot is never overwritten.\n");
+
+    printf("[TEST] Concurrent publish/read: no torn states...\n");
+    Writer w = {&snap, &src, 0};
+    pthread_t tid;
+    pthread_create(&tid, NULL, publish_all, &w);
+    int cells = src.torus_dim * src.torus_dim;
+    float last = 0.0f;
+    long reads = 0, distinct = 0;
+    for (;;) {
+        int finished = atomic_load(&w.done);
+        const SystemState *s = qcore_snapshot_read(&snap);
+        for (int k = 0; k < cells; k++) {
+            assert(s->phi_re[k] == s->time && s->phi_im[k] == -s->time);
+        }
+        assert(s->time >= last);
+        distinct += (s->time != last);
+        last = s->time;
+        reads++;
+        if (finished) break;
+        sched_yield();
+    }
+    pthread_join(tid, NULL);
+    assert(qcore_snapshot_read(&snap)->time == (float)PUBLISH_N);
+    printf("  %ld reads saw %ld distinct publications of %d\n", reads, distinct, PUBLISH_N);
+    printf("PASS: Every read was one whole publication, in order.\n");
+    qcore_snapshot_release(&snap);
+    release_system(&src);
+
+    printf("[TEST] Runner: flat out, commands, final state...\n");
+    SystemState state;
+    memset(&state, 0, sizeof(state));
+    assert(init_system(&state) == 0);
+    RunnerConfig config = {0.05f, 0.0f, NULL, NULL, NULL};
+    QcoreRunner *runner = qcore_runner_start(&state, &config);
+    assert(runner);
+    assert(qcore_runner_adjust_shear(runner, -2.5f) == 0);
+    while (qcore_runner_steps(runner) < 2000) sched_yield();
+    sleep_sec(0.01);                                           // Unread snapshots are republished
+    const SystemState *view = qcore_runner_snapshot(runner);
+    assert(view->time > 0.05f * 1000 && view->torus_dim == state.torus_dim);
+    assert(view->shear_flow == 7.5f);                          // Starts at 10
+    assert(qcore_runner_adjust_shear(runner, -100.0f) == 0);   // Clamped when applied
+    qcore_runner_stop(runner);
+    assert(state.shear_flow == 0.0f);
+    printf("PASS: Steps ran, shear change clamped, state returned to the caller.\n");
+
+    printf("[TEST] Runner: rate limit...\n");
+    config.rate_hz = 200.0f;
+    runner = qcore_runner_start(&state, &config);
+    double t0 = qcore_monotonic_sec();
+    sleep_sec(0.3);
+    uint64_t steps = qcore_runner_steps(runner);
+    double elapsed = qcore_monotonic_sec() - t0;
+    qcore_runner_stop(runner);
+    printf("  200 Hz for %.3f s: %llu steps\n", elapsed, (unsigned long long)steps);
+    assert(steps >= 10 && (double)steps <= elapsed * 200.0 + 2.0);
+    printf("PASS: Paced steps never run ahead of the clock.\n");
+
+    printf("[TEST] Rate counter...\n");
+    QcoreRate rate = {0};
+    assert(qcore_rate_update(&rate, 0, 10.0) == 0.0);
+    assert(qcore_rate_update(&rate, 30, 10.25) == 0.0);      // Window not over yet
+    assert(qcore_rate_update(&rate, 60, 11.0) == 60.0);
+    assert(qcore_rate_update(&rate, 90, 11.5) == 60.0);
+    printf("PASS: Rates refresh once per window.\n");
+
+    release_system(&state);
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
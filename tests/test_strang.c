@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <time.h>
+#include "../kernel/qcore_metriplectic.h"
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Worst |Phi|^2 over the torus
+static float peak_intensity(const SystemState *s) {
+    float peak = 0.0f;
+    for (int k = 0; k < s->torus_dim * s->torus_dim; k++) {
+        float in = s->phi_re[k] * s->phi_re[k] + s->phi_im[k] * s->phi_im[k];
+        if (!(in <= peak)) peak = in;
+    }
+    return peak;
+}
+
+int main() {
+    SystemState s;
+    memset(&s, 0, sizeof(s));
+
+    printf("[TEST] Strang split: rotation keeps |Phi|, relaxation is monotone...\n");
+    assert(init_system(&s) == 0);
+    s.integrator = INTEGRATOR_STRANG;
+    s.stability = 100.0f;              // decay 0: fixed point |Phi|^2 = 1
+    s.time = 1.0f;
+    float before[TORUS_DIM * TORUS_DIM];
+    for (int k = 0; k < TORUS_DIM * TORUS_DIM; k++) {
+        before[k] = s.phi_re[k] * s.phi_re[k] + s.phi_im[k] * s.phi_im[k];
+    }
+    apply_breathing_projector(&s, 3.0f);
+    for (int k = 0; k < TORUS_DIM * TORUS_DIM; k++) {
+        float after = s.phi_re[k] * s.phi_re[k] + s.phi_im[k] * s.phi_im[k];
+        // Every cell moves toward 1 and never past it
+        if (before[k] > 1.0f) assert(after <= before[k] && after >= 1.0f - 1e-6f);
+        else assert(after >= before[k] - 1e-6f && after <= 1.0f + 1e-6f);
+    }
+    s.shear_flow = 0.0f;               // No pump, no decay: pure rotation
+    for (int k = 0; k < TORUS_DIM * TORUS_DIM; k++) {
+        before[k] = s.phi_re[k] * s.phi_re[k] + s.phi_im[k] * s.phi_im[k];
+    }
+    apply_breathing_projector(&s, 3.0f);
+    for (int k = 0; k < TORUS_DIM * TORUS_DIM; k++) {
+        float after = s.phi_re[k] * s.phi_re[k] + s.phi_im[k] * s.phi_im[k];
+        assert(fabsf(after - before[k]) <= 1e-5f * before[k] + 1e-7f);
+    }
+    release_system(&s);
+    printf("PASS: Norm-preserving rotation, overshoot-free drive.\n");
+
+    printf("[TEST] Protocol Alpha and LaSalle at 5x and 10x dt...\n");
+    const float dts[] = {0.25f, 0.5f};
+    for (int i = 0; i < 2; i++) {
+        float dt = dts[i];
+
+        // test_protocol_alpha: 5000 steps, Mach 10
+        assert(init_system(&s) == 0);
+        s.integrator = INTEGRATOR_STRANG;
+        float peak = 0.0f;
+        for (int step = 0; step < 5000; step++) {
+            solve_step(&s, dt);
+            float p = peak_intensity(&s);
+            if (!(p <= peak)) peak = p;
+        }
+        printf("  dt %.2f: L2 error %.4f, thermal eff %.2f, peak |Phi|^2 %.3f\n",
+               dt, s.l2_error, s.thermal_eff, peak);
+        assert(s.l2_error < 0.1f);
+        assert(s.thermal_eff > 30.0f);
+        assert(peak < 2.0f);
+        release_system(&s);
+
+        // test_lasalle: 10000 steps
+        assert(init_system(&s) == 0);
+        s.integrator = INTEGRATOR_STRANG;
+        int locks = 0;
+        for (int step = 0; step < 10000; step++) {
+            solve_step(&s, dt);
+            if (s.is_lasalle_locked) locks++;
+        }
+        printf("  dt %.2f: V %.4f, %d locked steps\n", dt, s.lyapunov_v, locks);
+        assert(s.lyapunov_v < 1500.0f);
+        assert(locks > 100);
+        release_system(&s);
+    }
+    printf("PASS: Long-run statistics hold.\n");
+
+    printf("[BENCH] Wall time per simulated second, 256x256 torus:\n");
+    struct { QcoreIntegrator scheme; float dt; } runs[] = {
+        {INTEGRATOR_EULER, 0.05f}, {INTEGRATOR_STRANG, 0.05f},
+        {INTEGRATOR_STRANG, 0.25f}, {INTEGRATOR_STRANG, 0.5f},
+    };
+    double euler_ms = 0.0;
+    for (int r = 0; r < 4; r++) {
+        assert(init_system_dim(&s, 256) == 0);
+        s.integrator = runs[r].scheme;
+        int steps = (int)(20.0f / runs[r].dt);     // 20 simulated seconds
+        double t0 = now_sec();
+        for (int step = 0; step < steps; step++) solve_step(&s, runs[r].dt);
+        double ms = (now_sec() - t0) * 1e3 / 20.0;
+        if (r == 0) euler_ms = ms;
+        assert(isfinite(s.sync_clock_c));
+        printf("  %-6s dt %.2f: %.3f ms per simulated second (%.2fx Euler at dt 0.05)\n",
+               runs[r].scheme == INTEGRATOR_STRANG ? "strang" : "euler", runs[r].dt, ms, euler_ms / ms);
+        release_system(&s);
+    }
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}
@@ -4,7 +4,7 @@
 
 int main() {
     SystemState state;
-    init_system(&state);
+    assert(init_system(&state) == 0);
 
     printf("[TEST] Initializing Thermal Dynamics Test...\n");
     assert(state.temperature == 22.0f);
@@ -38,6 +38,7 @@ int main() {
     assert(state.temperature < high_temp);
     printf("PASS: Temperature decayed from %.2f C to %.2f C\n", high_temp, state.temperature);
 
+    release_system(&state);
     printf("ALL TESTS PASSED\n");
     return 0;
 }
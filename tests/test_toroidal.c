@@ -4,7 +4,7 @@
 
 int main() {
     SystemState state;
-    init_system(&state);
+    assert(init_system(&state) == 0);
 
     printf("[TEST] Initializing Toroidal Manifold...\n");
     assert(state.time == 0.0f);
@@ -47,6 +47,7 @@ int main() {
     printf("[TEST] Verifying Stability bounds...\n");
     assert(state.stability >= 0.0f && state.stability <= 100.0f);
 
+    release_system(&state);
     printf("ALL TESTS PASSED\n");
     return 0;
 }
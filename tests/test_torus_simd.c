@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+#include <stdint.h>
+#include "../kernel/qcore_metriplectic.h"
+#include "../kernel/qcore_torus_simd.h"
+
+// Per-cell updates use the same expression tree on every ISA, so stored
+// cells are expected to match exactly; the tolerance only absorbs compilers
+// that contract the scalar reference into FMA. The reduction is reordered
+// across lanes, so the sync clock sum is held to the worst-case bound of a
+// sequential float sum over n terms: n * u, with u = FLT_EPSILON / 2.
+#define CELL_TOL 1e-6f
+#define SUM_REL_TOL(n) ((float)(n) * FLT_EPSILON * 0.5f)
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void fill_field(float *re, float *im, int n) {
+    for (int k = 0; k < n; k++) {
+        re[k] = k_cos((float)k * 0.37f);
+        im[k] = k_cos((float)k * 0.37f * PHI);
+    }
+}
+
+static int check_isa(TorusIsa isa, int n, int strang) {
+    float *re_a = malloc(n * sizeof(float)), *im_a = malloc(n * sizeof(float));
+    float *re_b = malloc(n * sizeof(float)), *im_b = malloc(n * sizeof(float));
+    fill_field(re_a, im_a, n);
+    memcpy(re_b, re_a, n * sizeof(float));
+    memcpy(im_b, im_a, n * sizeof(float));
+
+    assert(torus_isa_select(isa) == 0);
+    float max_cell = 0.0f, max_rel = 0.0f;
+    for (int step = 0; step < 200; step++) {
+        float t = (float)step * 0.05f;
+        float On = golden_operator(t);
+        TorusDrive d = {k_cos(On * 0.1f), k_sin(On * 0.1f), 0.1f, 0.05f, 0.05f, On * On,
+                        strang, 0.9975f, 0.0049f};
+
+        float ref = torus_fused_scalar(re_a, im_a, n, &d);
+        float vec = torus_fused_update(re_b, im_b, n, &d);
+
+        for (int k = 0; k < n; k++) {
+            float dr = fabsf(re_a[k] - re_b[k]), di = fabsf(im_a[k] - im_b[k]);
+            if (dr > max_cell) max_cell = dr;
+            if (di > max_cell) max_cell = di;
+        }
+        float rel = fabsf(ref - vec) / (fabsf(ref) + 1e-30f);
+        if (rel > max_rel) max_rel = rel;
+    }
+
+    int ok = (max_cell <= CELL_TOL) && (max_rel <= SUM_REL_TOL(n));
+    printf("  %-7s %-6s n=%-7d max |cell diff| = %.3g, max sum rel err = %.3g  %s\n",
+           torus_isa_name(isa), strang ? "strang" : "euler", n, max_cell, max_rel, ok ? "OK" : "FAIL");
+    free(re_a); free(im_a); free(re_b); free(im_b);
+    return ok;
+}
+
+int main() {
+    TorusIsa best = torus_isa_detect();
+    printf("[TEST] CPUID selects fused torus kernel: %s\n", torus_isa_name(best));
+
+    printf("[TEST] Fused vector kernels vs scalar reference (cell tol %.0e, sum rel tol n*u)...\n",
+           CELL_TOL);
+    int sizes[] = {TORUS_DIM * TORUS_DIM, 1003, 256 * 256};
+    for (int isa = TORUS_ISA_SSE2; isa <= (int)best; isa++) {
+        for (int s = 0; s < 3; s++) {
+            assert(check_isa((TorusIsa)isa, sizes[s], 0));
+            assert(check_isa((TorusIsa)isa, sizes[s], 1));
+        }
+    }
+    printf("PASS: Vector kernels agree with the scalar reference.\n");
+
+    printf("[TEST] Row-block kernel matches per-row torus_fused_update (bit-identical)...\n");
+    for (int run = 0; run <= 2 * (int)best + 1; run++) {
+        int isa = run / 2, strang = run % 2;
+        enum { ROWS = 13, COLS = 37 };  // Odd width exercises every vector tail
+        static float re_a[ROWS * COLS], im_a[ROWS * COLS], re_b[ROWS * COLS], im_b[ROWS * COLS];
+        float sums_a[ROWS], sums_b[ROWS];
+        fill_field(re_a, im_a, ROWS * COLS);
+        memcpy(re_b, re_a, sizeof(re_a));
+        memcpy(im_b, im_a, sizeof(im_a));
+        assert(torus_isa_select((TorusIsa)isa) == 0);
+        TorusDrive d = {k_cos(0.1f), k_sin(0.1f), 0.1f, 0.05f, 0.05f, 0.7f, strang, 0.9975f, 0.0049f};
+        torus_fused_rows(re_a, im_a, ROWS, COLS, &d, sums_a);
+        for (int i = 0; i < ROWS; i++) {
+            sums_b[i] = torus_fused_update(re_b + i * COLS, im_b + i * COLS, COLS, &d);
+        }
+        assert(memcmp(re_a, re_b, sizeof(re_a)) == 0 && memcmp(im_a, im_b, sizeof(im_a)) == 0);
+        assert(memcmp(sums_a, sums_b, sizeof(sums_a)) == 0);
+    }
+    printf("PASS: Row sums are the per-row reductions.\n");
+
+    printf("[TEST] Fused solve_step vs two-pass reference (scalar ISA, bit-identical)...\n");
+    assert(torus_isa_select(TORUS_ISA_SCALAR) == 0);
+    for (int scheme = INTEGRATOR_EULER; scheme <= INTEGRATOR_STRANG; scheme++) {
+        SystemState a, b;
+        assert(init_system(&a) == 0);
+        assert(init_system(&b) == 0);
+        a.integrator = b.integrator = (QcoreIntegrator)scheme;
+        for (int i = 0; i < 1000; i++) {
+            solve_step(&a, 0.05f);
+
+            // Reference: the per-cell projector loop and the separate
+            // reduction, then the same remaining stages
+            b.time += 0.05f;
+            apply_breathing_projector(&b, 0.05f);
+            float c = compute_sync_clock(&b);
+            assert(c == a.sync_clock_c);
+            size_t bytes = (size_t)a.torus_dim * a.torus_dim * sizeof(float);
+            assert(memcmp(b.phi_re, a.phi_re, bytes) == 0);
+            assert(memcmp(b.phi_im, a.phi_im, bytes) == 0);
+            assert(copy_system(&b, &a) == 0);
+        }
+        release_system(&a);
+        release_system(&b);
+    }
+    printf("PASS: Fused Euler and Strang passes reproduce apply_breathing_projector + compute_sync_clock.\n");
+
+    printf("[TEST] Strang split keeps |Phi|^2 bounded where the Euler drive fails...\n");
+    // Near |Phi|^2 = 1 the Euler drive scales the intensity error by
+    // 1 - 2*pump*dt: past dt 10 (pump 0.1) it grows every step
+    for (int scheme = INTEGRATOR_EULER; scheme <= INTEGRATOR_STRANG; scheme++) {
+        SystemState g;
+        assert(init_system(&g) == 0);
+        g.integrator = (QcoreIntegrator)scheme;
+        float peak = 0.0f;
+        for (int i = 0; i < 200; i++) {
+            solve_step(&g, 20.0f);
+            for (int k = 0; k < g.torus_dim * g.torus_dim; k++) {
+                float in = g.phi_re[k] * g.phi_re[k] + g.phi_im[k] * g.phi_im[k];
+                if (!(in <= peak)) peak = in;
+            }
+        }
+        printf("  %-6s dt 20: peak |Phi|^2 = %.3g\n", scheme ? "strang" : "euler", peak);
+        if (scheme == INTEGRATOR_STRANG) assert(isfinite(peak) && peak <= 2.0f);
+        else assert(!(peak <= 2.0f));
+        release_system(&g);
+    }
+    printf("PASS: Exact relaxation is unconditionally stable.\n");
+
+    printf("[TEST] Runtime torus resolutions (aligned buffers, finite sync clock)...\n");
+    int dims[] = {TORUS_DIM, 32, 256, 1024};
+    for (int k = 0; k < 4; k++) {
+        SystemState g;
+        assert(init_system_dim(&g, dims[k]) == 0);
+        assert(((uintptr_t)g.phi_re % QCORE_FIELD_ALIGN) == 0);
+        assert(((uintptr_t)g.phi_im % QCORE_FIELD_ALIGN) == 0);
+        for (int i = 0; i < 10; i++) solve_step(&g, 0.05f);
+        assert(isfinite(g.sync_clock_c) && g.sync_clock_c > 0.0f);
+        printf("  %4dx%-4d block %-6s c = %.3g\n", dims[k], dims[k],
+               g.field.kind == FIELD_BLOCK_MMAP ? "mmap" : "heap", g.sync_clock_c);
+        release_system(&g);
+    }
+    SystemState bad;
+    assert(init_system_dim(&bad, TORUS_DIM_MAX + 1) == -1);
+    printf("PASS: Grids up to %dx%d run through solve_step.\n", TORUS_DIM_MAX, TORUS_DIM_MAX);
+
+    printf("[BENCH] Fused torus update on a 256x256 field:\n");
+    int n = 256 * 256;
+    float *re = malloc(n * sizeof(float)), *im = malloc(n * sizeof(float));
+    fill_field(re, im, n);
+    for (int isa = TORUS_ISA_SCALAR; isa <= (int)best; isa++) {
+        torus_isa_select((TorusIsa)isa);
+        double rate[2];
+        for (int strang = 0; strang < 2; strang++) {
+            TorusDrive d = {0.999f, 0.0447f, 0.1f, 0.05f, 0.05f, 0.5f, strang, 0.9975f, 0.0049f};
+            volatile float sink = 0.0f;
+            double t0 = now_sec();
+            for (int r = 0; r < 200; r++) sink += torus_fused_update(re, im, n, &d);
+            rate[strang] = 200.0 * n / (now_sec() - t0);
+        }
+        printf("  %-7s %.3e cells/s (strang %.3e)\n", torus_isa_name((TorusIsa)isa), rate[0], rate[1]);
+    }
+    free(re); free(im);
+
+    printf("ALL TESTS PASSED\n");
+    return 0;
+}